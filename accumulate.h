@@ -0,0 +1,209 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Fail-safe compound assignment.
+ *
+ *  Accumulate a value into an existing object, preferring the compound
+ *  assignment operator (`t += u`) if available, and otherwise falling
+ *  back to the binary operator (`t = t + u`). Compound assignment
+ *  avoids a temporary, and for heap-backed types, such as strings
+ *  or big numbers, usually an allocation per call.
+ *
+ *  \synopsis
+ *      struct add_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ *
+ *      struct sub_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ *
+ *      struct mul_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ *
+ *      struct div_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ *
+ *      struct mod_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ *
+ *      struct and_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ *
+ *      struct or_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ *
+ *      struct xor_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ *
+ *      struct shl_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ *
+ *      struct shr_to
+ *      {
+ *          template <typename T, typename U>
+ *          T& operator()(T& t, U&& u) const;
+ *      };
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/has_bit_and_assign.h>
+#include <pycpp/sfinae/has_bit_or_assign.h>
+#include <pycpp/sfinae/has_bit_xor_assign.h>
+#include <pycpp/sfinae/has_divides_assign.h>
+#include <pycpp/sfinae/has_left_shift_assign.h>
+#include <pycpp/sfinae/has_minus_assign.h>
+#include <pycpp/sfinae/has_modulus_assign.h>
+#include <pycpp/sfinae/has_multiplies_assign.h>
+#include <pycpp/sfinae/has_plus_assign.h>
+#include <pycpp/sfinae/has_right_shift_assign.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+// MACROS
+// ------
+
+#if defined(PYCPP_CPP20)
+
+#define PYCPP_ACCUMULATE(name, trait, op, assign_op)                           \
+    struct name                                                                 \
+    {                                                                           \
+        template <typename T, typename U>                                       \
+        PYCPP_SFINAE_INLINE                                                     \
+        T&                                                                      \
+        operator()(                                                             \
+            T &t,                                                               \
+            U &&u                                                               \
+        )                                                                       \
+        const                                                                   \
+        {                                                                       \
+            if constexpr (trait<T, U&&>::value) {                               \
+                t assign_op forward<U>(u);                                      \
+            } else {                                                            \
+                t = t op forward<U>(u);                                         \
+            }                                                                   \
+            return t;                                                           \
+        }                                                                       \
+    }
+
+#else
+
+#define PYCPP_ACCUMULATE(name, trait, op, assign_op)                           \
+    struct name                                                                 \
+    {                                                                           \
+        template <typename T, typename U>                                       \
+        PYCPP_SFINAE_INLINE                                                     \
+        enable_if_t<trait<T, U&&>::value, T&>                                   \
+        operator()(                                                             \
+            T &t,                                                               \
+            U &&u                                                               \
+        )                                                                       \
+        const                                                                   \
+        {                                                                       \
+            t assign_op forward<U>(u);                                          \
+            return t;                                                           \
+        }                                                                       \
+                                                                                \
+        template <typename T, typename U>                                       \
+        PYCPP_SFINAE_INLINE                                                     \
+        enable_if_t<!trait<T, U&&>::value, T&>                                  \
+        operator()(                                                             \
+            T &t,                                                               \
+            U &&u                                                               \
+        )                                                                       \
+        const                                                                   \
+        {                                                                       \
+            t = t op forward<U>(u);                                             \
+            return t;                                                           \
+        }                                                                       \
+    }
+
+#endif
+
+// FUNCTORS
+// --------
+
+/**
+ *  \brief Call `t += u`, or `t = t + u`, as a functor.
+ */
+PYCPP_ACCUMULATE(add_to, has_plus_assign, +, +=);
+
+/**
+ *  \brief Call `t -= u`, or `t = t - u`, as a functor.
+ */
+PYCPP_ACCUMULATE(sub_to, has_minus_assign, -, -=);
+
+/**
+ *  \brief Call `t *= u`, or `t = t * u`, as a functor.
+ */
+PYCPP_ACCUMULATE(mul_to, has_multiplies_assign, *, *=);
+
+/**
+ *  \brief Call `t /= u`, or `t = t / u`, as a functor.
+ */
+PYCPP_ACCUMULATE(div_to, has_divides_assign, /, /=);
+
+/**
+ *  \brief Call `t %= u`, or `t = t % u`, as a functor.
+ */
+PYCPP_ACCUMULATE(mod_to, has_modulus_assign, %, %=);
+
+/**
+ *  \brief Call `t &= u`, or `t = t & u`, as a functor.
+ */
+PYCPP_ACCUMULATE(and_to, has_bit_and_assign, &, &=);
+
+/**
+ *  \brief Call `t |= u`, or `t = t | u`, as a functor.
+ */
+PYCPP_ACCUMULATE(or_to, has_bit_or_assign, |, |=);
+
+/**
+ *  \brief Call `t ^= u`, or `t = t ^ u`, as a functor.
+ */
+PYCPP_ACCUMULATE(xor_to, has_bit_xor_assign, ^, ^=);
+
+/**
+ *  \brief Call `t <<= u`, or `t = t << u`, as a functor.
+ */
+PYCPP_ACCUMULATE(shl_to, has_left_shift_assign, <<, <<=);
+
+/**
+ *  \brief Call `t >>= u`, or `t = t >> u`, as a functor.
+ */
+PYCPP_ACCUMULATE(shr_to, has_right_shift_assign, >>, >>=);
+
+#undef PYCPP_ACCUMULATE
+
+PYCPP_END_NAMESPACE
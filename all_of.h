@@ -0,0 +1,39 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Conjunction of a pack of booleans.
+ *
+ *  Implementation detail shared by the type traits and functors.
+ *  `all_of` is true if every boolean in the pack is true, or the
+ *  pack is empty, without recursive instantiation.
+ *
+ *  \synopsis
+ *      namespace sfinae_detail
+ *      {
+ *          template <bool... Bs>
+ *          using all_of = implementation-defined;
+ *      }
+ */
+
+#pragma once
+
+#include <pycpp/stl/type_traits.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace sfinae_detail
+{
+// SFINAE
+// ------
+
+template <bool... Bs>
+struct bool_pack
+{};
+
+template <bool... Bs>
+using all_of = is_same<bool_pack<true, Bs...>, bool_pack<Bs..., true>>;
+
+}   /* sfinae_detail */
+
+PYCPP_END_NAMESPACE
@@ -0,0 +1,56 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Function attributes for the fail-safe functors.
+ *
+ *  `PYCPP_SFINAE_CONSTEXPR` expands to `constexpr` from C++14, since
+ *  C++11 constexpr functions cannot contain statements.
+ *
+ *  `PYCPP_SFINAE_INLINE` expands to `inline`, unless
+ *  `PYCPP_SFINAE_FORCE_INLINE` is defined, in which case the thin
+ *  functors wrapping a single member call or operator are always
+ *  inlined, even without optimizations (`always_inline`), and are
+ *  stepped over by debuggers (`artificial`). This removes a call
+ *  frame per functor in `-O0` and `-Og` builds.
+ *
+ *  `PYCPP_SFINAE_PROFILE_SCOPE` expands to nothing, unless
+ *  `PYCPP_SFINAE_PROFILE` is defined, in which case it is defined by
+ *  `profile.h` to count the calls through each path.
+ *
+ *  \synopsis
+ *      #define PYCPP_SFINAE_CONSTEXPR implementation-defined
+ *      #define PYCPP_SFINAE_INLINE implementation-defined
+ *      #define PYCPP_SFINAE_PROFILE_SCOPE(functor, T, native) implementation-defined
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+
+// MACROS
+// ------
+
+#if defined(PYCPP_CPP14)
+#   define PYCPP_SFINAE_CONSTEXPR constexpr
+#else
+#   define PYCPP_SFINAE_CONSTEXPR
+#endif
+
+#if defined(PYCPP_SFINAE_FORCE_INLINE) && defined(__has_attribute)
+#   if __has_attribute(always_inline) && __has_attribute(artificial)
+#       define PYCPP_SFINAE_INLINE __attribute__((always_inline, artificial)) inline
+#   elif __has_attribute(always_inline)
+#       define PYCPP_SFINAE_INLINE __attribute__((always_inline)) inline
+#   endif
+#elif defined(PYCPP_SFINAE_FORCE_INLINE) && defined(_MSC_VER)
+#   define PYCPP_SFINAE_INLINE __forceinline
+#endif
+
+#ifndef PYCPP_SFINAE_INLINE
+#   define PYCPP_SFINAE_INLINE inline
+#endif
+
+#if !defined(PYCPP_SFINAE_PROFILE)
+#   define PYCPP_SFINAE_PROFILE_SCOPE(functor, T, native)
+#endif
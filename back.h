@@ -8,16 +8,22 @@
  *
  *  \synopsis
  *      template <typename T>
- *      struct has_back: implementation_defined
+ *      using has_back = bool_constant<container_traits<T>::has_back>;
+ *
+ *      template <typename T>
+ *      struct is_nothrow_back: implementation_defined
  *      {};
  *
  *      struct back
  *      {
  *          template <typename T>
- *          typename T::reference operator()(T& t);
+ *          constexpr typename T::reference operator()(T& t) noexcept(is_nothrow_back<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr typename T::const_reference operator()(const T& t) noexcept(is_nothrow_back<const T>::value);
  *
  *          template <typename T>
- *          typename T::const_reference operator()(const T& t);
+ *          constexpr fallback_detail::reference_t<T> operator()(allow_fallback_t, T& t) noexcept(is_nothrow_back<T>::value);
  *      };
  *
  *      #if PYCPP_CPP14
@@ -25,11 +31,19 @@
  *      template <typename T>
  *      constexpr bool has_back_v = implementation-defined;
  *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_back_v = implementation-defined;
+ *
  *      #endif
  */
 
 #pragma once
 
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/container_traits.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/profile.h>
 #include <pycpp/stl/type_traits.h>
 #include <pycpp/stl/utility.h>
 
@@ -40,14 +54,12 @@ namespace back_detail
 // SFINAE
 // ------
 
-template <typename T>
-using dereference_iterator_type = decltype(*declval<typename T::iterator>());
-
-template <typename T>
-using is_const_iterator = is_same<dereference_iterator_type<T>, typename T::const_reference>;
+template <bool Native, typename T>
+struct is_nothrow: bool_constant<noexcept(declval<T&>().back())>
+{};
 
 template <typename T>
-struct is_const: bool_constant<PYCPP_NAMESPACE::is_const<T>::value || is_const_iterator<T>::value>
+struct is_nothrow<false, T>: bool_constant<noexcept(*declval<T&>().rbegin())>
 {};
 
 }   /* back_detail */
@@ -55,8 +67,17 @@ struct is_const: bool_constant<PYCPP_NAMESPACE::is_const<T>::value || is_const_i
 // SFINAE
 // ------
 
-PYCPP_HAS_MEMBER_FUNCTION(back, has_back, typename C::reference (C::*)());
+/**
+ *  Detect a native `back`, from `container_traits`.
+ */
+template <typename T>
+using has_back = bool_constant<container_traits<T>::has_back>;
 
+/**
+ *  Detect if the call selected by `back` cannot throw.
+ */
+template <typename T>
+using is_nothrow_back = back_detail::is_nothrow<container_traits<remove_const_t<T>>::has_back, T>;
 
 /**
  *  \brief Call `back` as a functor.
@@ -65,43 +86,120 @@ PYCPP_HAS_MEMBER_FUNCTION(back, has_back, typename C::reference (C::*)());
  */
 struct back
 {
-    template <typename T>
-    enable_if_t<has_back<T>::value && !back_detail::is_const<T>::value, typename T::reference>
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T>
+    requires (!fallback_detail::is_const<T>::value)
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    typename T::reference
+    operator()(
+        T &t
+    )
+    noexcept(is_nothrow_back<T>::value)
+    {
+        if constexpr (container_traits<T>::has_back) {
+            PYCPP_SFINAE_PROFILE_SCOPE(back, T, true);
+            return t.back();
+        } else {
+            PYCPP_SFINAE_REQUIRE_COMPLEXITY(back, T, AllowFallback);
+            PYCPP_SFINAE_PROFILE_SCOPE(back, T, false);
+            return *t.rbegin();
+        }
+    }
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    typename T::const_reference
+    operator()(
+        const T &t
+    )
+    const
+    noexcept(is_nothrow_back<const T>::value)
+    {
+        if constexpr (container_traits<T>::has_back) {
+            PYCPP_SFINAE_PROFILE_SCOPE(back, T, true);
+            return t.back();
+        } else {
+            PYCPP_SFINAE_REQUIRE_COMPLEXITY(back, T, AllowFallback);
+            PYCPP_SFINAE_PROFILE_SCOPE(back, T, false);
+            return *t.rbegin();
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_back && !fallback_detail::is_const<T>::value, typename T::reference>
     operator()(
         T &t
     )
+    noexcept(is_nothrow_back<T>::value)
     {
+        PYCPP_SFINAE_PROFILE_SCOPE(back, T, true);
         return t.back();
     }
 
-    template <typename T>
-    enable_if_t<!has_back<T>::value && !back_detail::is_const<T>::value, typename T::reference>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_back && !fallback_detail::is_const<T>::value, typename T::reference>
     operator()(
         T &t
     )
+    noexcept(is_nothrow_back<T>::value)
     {
+        PYCPP_SFINAE_REQUIRE_COMPLEXITY(back, T, AllowFallback);
+        PYCPP_SFINAE_PROFILE_SCOPE(back, T, false);
         return *t.rbegin();
     }
 
-    template <typename T>
-    enable_if_t<has_back<T>::value, typename T::const_reference>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_back, typename T::const_reference>
     operator()(
         const T &t
     )
     const
+    noexcept(is_nothrow_back<const T>::value)
     {
+        PYCPP_SFINAE_PROFILE_SCOPE(back, T, true);
         return t.back();
     }
 
-    template <typename T>
-    enable_if_t<!has_back<T>::value, typename T::const_reference>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_back, typename T::const_reference>
     operator()(
         const T &t
     )
     const
+    noexcept(is_nothrow_back<const T>::value)
     {
+        PYCPP_SFINAE_REQUIRE_COMPLEXITY(back, T, AllowFallback);
+        PYCPP_SFINAE_PROFILE_SCOPE(back, T, false);
         return *t.rbegin();
     }
+
+#endif
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    fallback_detail::reference_t<T>
+    operator()(
+        allow_fallback_t,
+        T &t
+    )
+    noexcept(is_nothrow_back<T>::value)
+    {
+        return this->template operator()<true>(t);
+    }
 };
 
 #ifdef PYCPP_CPP14
@@ -110,8 +208,17 @@ struct back
 // ------
 
 template <typename T>
-constexpr bool has_back_v = has_back<T>::value;
+constexpr bool has_back_v = container_traits<T>::has_back;
+
+template <typename T>
+constexpr bool is_nothrow_back_v = is_nothrow_back<T>::value;
 
 #endif
 
 PYCPP_END_NAMESPACE
+
+// Strict mode checks the cost of the fallback, from `complexity.h`,
+// unless a batch functor includes it once the batch functor is defined.
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY) && !defined(PYCPP_SFINAE_DETAIL_DEFER_COMPLEXITY)
+#   include <pycpp/sfinae/complexity.h>
+#endif
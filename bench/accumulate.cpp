@@ -0,0 +1,143 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Runtime benchmark for the compound assignment functors.
+ *
+ *  Accumulates into a `std::string` and a heap-backed big number,
+ *  comparing `add_to` (which calls `+=`) to the binary operator
+ *  (`t = t + u`). Build with optimizations enabled.
+ */
+
+#include <pycpp/sfinae/accumulate.h>
+#include <pycpp/stl/string.h>
+#include <pycpp/stl/vector.h>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifndef PYCPP_BENCH_ITERATIONS
+#   define PYCPP_BENCH_ITERATIONS 10000
+#endif
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace bench
+{
+// OBJECTS
+// -------
+
+/**
+ *  \brief Unsigned big number, stored as little-endian 32-bit limbs.
+ */
+struct bignum
+{
+    vector<uint32_t> limbs;
+
+    bignum&
+    operator+=(
+        const bignum &other
+    )
+    {
+        if (limbs.size() < other.limbs.size()) {
+            limbs.resize(other.limbs.size());
+        }
+        uint64_t carry = 0;
+        for (size_t i = 0; i < limbs.size(); ++i) {
+            uint64_t sum = carry + limbs[i] + (i < other.limbs.size() ? other.limbs[i] : 0);
+            limbs[i] = static_cast<uint32_t>(sum);
+            carry = sum >> 32;
+        }
+        if (carry) {
+            limbs.push_back(static_cast<uint32_t>(carry));
+        }
+        return *this;
+    }
+
+    friend
+    bignum
+    operator+(
+        const bignum &lhs,
+        const bignum &rhs
+    )
+    {
+        bignum result = lhs;
+        result += rhs;
+        return result;
+    }
+};
+
+// FUNCTIONS
+// ---------
+
+template <typename F>
+double
+time(
+    F f
+)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void
+report(
+    const char* name,
+    double binary,
+    double compound
+)
+{
+    printf("%-8s t = t + u: %10.3f ms, add_to: %10.3f ms, speedup: %.2fx\n", name, binary, compound, binary / compound);
+}
+
+}   /* bench */
+
+PYCPP_END_NAMESPACE
+
+int main()
+{
+    using namespace PYCPP_NAMESPACE;
+    using namespace PYCPP_NAMESPACE::bench;
+
+    const size_t n = PYCPP_BENCH_ITERATIONS;
+    string piece = "key-";
+    size_t sink = 0;
+
+    double string_binary = bench::time([&]() {
+        string s;
+        for (size_t i = 0; i < n; ++i) {
+            s = s + piece;
+        }
+        sink += s.size();
+    });
+    double string_compound = bench::time([&]() {
+        string s;
+        for (size_t i = 0; i < n; ++i) {
+            add_to()(s, piece);
+        }
+        sink += s.size();
+    });
+    report("string", string_binary, string_compound);
+
+    bignum step;
+    step.limbs.assign(64, 0xFFFFFFFFU);
+    double bignum_binary = bench::time([&]() {
+        bignum b;
+        for (size_t i = 0; i < n; ++i) {
+            b = b + step;
+        }
+        sink += b.limbs.size();
+    });
+    double bignum_compound = bench::time([&]() {
+        bignum b;
+        for (size_t i = 0; i < n; ++i) {
+            add_to()(b, step);
+        }
+        sink += b.limbs.size();
+    });
+    report("bignum", bignum_binary, bignum_compound);
+
+    return sink == 0;
+}
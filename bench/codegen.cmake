@@ -0,0 +1,78 @@
+#  :copyright: (c) 2017-2018 Alex Huszagh.
+#  :license: MIT, see licenses/mit.md for more details.
+
+# Compile the codegen probes to assembly, and compare the body of
+# each `functor_<name>` to `direct_<name>`, writing the result to
+# `OUTPUT`. Fails if any pair differs. Invoked with `cmake -P`, with
+# `COMPILER`, `FLAGS`, `SOURCE` and `OUTPUT` defined.
+#
+# Directives are ignored, references to the probe itself (such as
+# its cold partition) are renamed, and local labels are renumbered
+# in order of appearance, so only the instructions are compared.
+
+separate_arguments(FLAGS)
+set(assembly ${OUTPUT}.s)
+execute_process(
+    COMMAND ${COMPILER} ${FLAGS} -O2 -S ${SOURCE} -o ${assembly}
+    RESULT_VARIABLE result
+    ERROR_VARIABLE stderr
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Unable to compile ${SOURCE}:\n${stderr}")
+endif()
+
+# Split the assembly into the normalized body of each probe.
+file(STRINGS ${assembly} lines)
+set(probes)
+set(current)
+foreach(line IN LISTS lines)
+    if(line MATCHES "^_?((functor|direct)_[A-Za-z0-9_]+):")
+        set(current ${CMAKE_MATCH_1})
+        set(body_${current})
+        set(labels_${current})
+        list(APPEND probes ${current})
+    elseif(current)
+        if(line MATCHES "^[ \t]*\\.cfi_endproc" OR line MATCHES "^[ \t]*\\.size[ \t]")
+            set(current)
+        elseif(NOT line MATCHES "^[ \t]*\\.[A-Za-z_]+([ \t]|$)" AND NOT line MATCHES "^[ \t]*(#|//|;)")
+            string(REPLACE "${current}" "<probe>" line "${line}")
+            string(REGEX MATCHALL "\\.L[A-Za-z0-9_]+" used "${line}")
+            foreach(label IN LISTS used)
+                list(FIND labels_${current} "${label}" index)
+                if(index EQUAL -1)
+                    list(LENGTH labels_${current} index)
+                    list(APPEND labels_${current} "${label}")
+                endif()
+                string(REPLACE "." "\\." pattern "${label}")
+                string(REGEX REPLACE "${pattern}([^A-Za-z0-9_]|$)" "<label${index}>\\1" line "${line}")
+            endforeach()
+            string(REGEX REPLACE "[ \t]+" " " line "${line}")
+            string(STRIP "${line}" line)
+            if(line)
+                string(APPEND body_${current} "${line}\n")
+            endif()
+        endif()
+    endif()
+endforeach()
+
+set(report)
+set(failures)
+foreach(probe IN LISTS probes)
+    if(probe MATCHES "^functor_(.*)$")
+        set(name ${CMAKE_MATCH_1})
+        if(NOT DEFINED body_direct_${name})
+            list(APPEND failures ${name})
+            string(APPEND report "${name}: missing direct_${name}\n")
+        elseif(body_functor_${name} STREQUAL body_direct_${name})
+            string(APPEND report "${name}: identical\n")
+        else()
+            list(APPEND failures ${name})
+            string(APPEND report "${name}: DIFFERS\n--- functor\n${body_functor_${name}}--- direct\n${body_direct_${name}}")
+        endif()
+    endif()
+endforeach()
+
+file(WRITE ${OUTPUT} "${report}")
+if(failures)
+    message(FATAL_ERROR "Functor codegen differs from the direct call for: ${failures}\n${report}")
+endif()
@@ -0,0 +1,110 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Codegen probes for the fail-safe functors.
+ *
+ *  Each probe defines `functor_<name>`, which calls a functor, and
+ *  `direct_<name>`, which calls the member function the functor
+ *  dispatches to. Functors combining several calls, such as the
+ *  geometric `reserve` policies and `extend`, are compared to the
+ *  same calls written by hand. `codegen.cmake` compiles this file to
+ *  assembly and fails if the two bodies differ.
+ */
+
+#include <pycpp/sfinae/functors.h>
+#include <pycpp/stl/deque.h>
+#include <pycpp/stl/list.h>
+#include <pycpp/stl/set.h>
+#include <pycpp/stl/string.h>
+#include <pycpp/stl/vector.h>
+#include <stddef.h>
+
+// Identical code folding would replace one probe of each pair
+// with an alias to the other.
+#if defined(__GNUC__) && !defined(__clang__)
+#   define PYCPP_CODEGEN_ATTRIBUTES __attribute__((noipa))
+#else
+#   define PYCPP_CODEGEN_ATTRIBUTES __attribute__((noinline))
+#endif
+
+#define PYCPP_CODEGEN_PROBE(name, ret, params, functor, direct)                 \
+    extern "C" PYCPP_CODEGEN_ATTRIBUTES ret functor_##name params               \
+    {                                                                           \
+        return functor;                                                         \
+    }                                                                           \
+    extern "C" PYCPP_CODEGEN_ATTRIBUTES ret direct_##name params                \
+    {                                                                           \
+        return direct;                                                          \
+    }
+
+PYCPP_USING_NAMESPACE
+
+/**
+ *  Grow the capacity geometrically, as written by hand.
+ */
+template <typename T>
+inline void grow(T& c, size_t size)
+{
+    size_t current = c.capacity();
+    if (size > current) {
+        c.reserve(size > 2 * current ? size : 2 * current);
+    }
+}
+
+/**
+ *  Reserve for, then append a range, as written by hand.
+ */
+template <typename T, typename It>
+inline void append_range(T& c, It first, It last)
+{
+    size_t n = static_cast<size_t>(distance(first, last));
+    grow(c, c.size() + n);
+    c.append(first, last);
+}
+
+// NATIVE
+// ------
+
+PYCPP_CODEGEN_PROBE(back, int&, (vector<int>& c), back()(c), c.back())
+PYCPP_CODEGEN_PROBE(back_const, const char&, (const string& c), back()(c), c.back())
+PYCPP_CODEGEN_PROBE(front, int&, (deque<int>& c), front()(c), c.front())
+PYCPP_CODEGEN_PROBE(push_back, void, (vector<int>& c, int v), push_back()(c, v), c.push_back(v))
+PYCPP_CODEGEN_PROBE(push_front, void, (deque<int>& c, int v), push_front()(c, v), c.push_front(v))
+PYCPP_CODEGEN_PROBE(emplace_back, void, (vector<int>& c, int v), emplace_back()(c, v), static_cast<void>(c.emplace_back(v)))
+PYCPP_CODEGEN_PROBE(emplace_front, void, (deque<int>& c, int v), emplace_front()(c, v), static_cast<void>(c.emplace_front(v)))
+PYCPP_CODEGEN_PROBE(pop_back, void, (vector<int>& c), pop_back()(c), c.pop_back())
+PYCPP_CODEGEN_PROBE(pop_front, void, (list<int>& c), pop_front()(c), c.pop_front())
+PYCPP_CODEGEN_PROBE(reserve, void, (vector<int>& c, size_t n), reserve()(c, n), c.reserve(n))
+PYCPP_CODEGEN_PROBE(shrink_to_fit, void, (string& c), shrink_to_fit()(c), c.shrink_to_fit())
+PYCPP_CODEGEN_PROBE(pop_front_n, void, (vector<int>& c, size_t n), pop_front_n()(c, n), static_cast<void>(c.erase(c.begin(), next(c.begin(), static_cast<ptrdiff_t>(n)))))
+PYCPP_CODEGEN_PROBE(pop_back_n, void, (deque<int>& c, size_t n), pop_back_n()(c, n), static_cast<void>(c.erase(prev(c.end(), static_cast<ptrdiff_t>(n)), c.end())))
+PYCPP_CODEGEN_PROBE(resize_uninitialized, void, (vector<int>& c, size_t n), resize_uninitialized()(c, n), c.resize(n))
+#if defined(__cpp_lib_string_resize_and_overwrite)
+PYCPP_CODEGEN_PROBE(resize_uninitialized_string, void, (string& c, size_t n), resize_uninitialized()(c, n, [](char*, size_t size) { return size; }), c.resize_and_overwrite(n, [](char*, size_t size) { return size; }))
+#endif
+
+// POLICIES
+// --------
+
+PYCPP_CODEGEN_PROBE(reserve_exact, void, (vector<int>& c, size_t n), reserve()(c, n, exact_reserve_t()), c.reserve(n))
+PYCPP_CODEGEN_PROBE(reserve_geometric, void, (vector<int>& c, size_t n), reserve()(c, n, geometric_reserve_t()), grow(c, n))
+PYCPP_CODEGEN_PROBE(reserve_additional, void, (vector<int>& c, size_t n), reserve()(c, n, additional_reserve_t()), grow(c, c.size() + n))
+
+// RANGES
+// ------
+
+PYCPP_CODEGEN_PROBE(extend_append, void, (string& c, const char* first, const char* last), extend()(c, first, last), append_range(c, first, last))
+PYCPP_CODEGEN_PROBE(extend_insert, void, (vector<int>& c, const int* first, const int* last), extend()(c, first, last), (grow(c, c.size() + static_cast<size_t>(distance(first, last))), static_cast<void>(c.insert(c.end(), first, last))))
+
+// FALLBACK
+// --------
+
+PYCPP_CODEGEN_PROBE(back_fallback, const int&, (const set<int>& c), back()(c), *c.rbegin())
+PYCPP_CODEGEN_PROBE(push_back_fallback, void, (set<int>& c, int v), push_back()(c, v), static_cast<void>(c.insert(c.end(), v)))
+PYCPP_CODEGEN_PROBE(pop_front_fallback, void, (vector<int>& c), pop_front()(c), static_cast<void>(c.erase(c.begin())))
+
+int main()
+{
+    return 0;
+}
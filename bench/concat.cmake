@@ -0,0 +1,13 @@
+#  :copyright: (c) 2017-2018 Alex Huszagh.
+#  :license: MIT, see licenses/mit.md for more details.
+
+# Concatenate every `*.lines` file in `DIRECTORY` into `OUTPUT`.
+# Invoked with `cmake -P`.
+
+file(GLOB inputs ${DIRECTORY}/*.lines)
+list(SORT inputs)
+file(WRITE ${OUTPUT} "")
+foreach(input ${inputs})
+    file(READ ${input} contents)
+    file(APPEND ${OUTPUT} "${contents}")
+endforeach()
@@ -0,0 +1,24 @@
+#  :copyright: (c) 2017-2018 Alex Huszagh.
+#  :license: MIT, see licenses/mit.md for more details.
+
+# Preprocess a single header, writing `<header> <lines>` to `OUTPUT`.
+# Invoked with `cmake -P`, with `COMPILER`, `FLAGS`, `HEADER` and
+# `OUTPUT` defined.
+
+separate_arguments(FLAGS)
+get_filename_component(directory ${OUTPUT} DIRECTORY)
+set(source ${OUTPUT}.cpp)
+file(WRITE ${source} "#include <pycpp/sfinae/${HEADER}>\n")
+execute_process(
+    COMMAND ${COMPILER} ${FLAGS} -E -P ${source}
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE preprocessed
+    ERROR_VARIABLE stderr
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Unable to preprocess ${HEADER}:\n${stderr}")
+endif()
+
+string(REGEX MATCHALL "\n" lines "${preprocessed}")
+list(LENGTH lines count)
+file(WRITE ${OUTPUT} "${HEADER} ${count}\n")
@@ -0,0 +1,94 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Compile-time benchmark for `PYCPP_HAS_OPERATION`.
+ *
+ *  Instantiates the operator detectors over `PYCPP_BENCH_TYPES`
+ *  synthetic types, using either the `void_t` implementation from
+ *  `has_op.h` or, if `PYCPP_BENCH_OVERLOAD` is defined, an
+ *  overload-resolution implementation of the same check: if the
+ *  expression is well-formed, whatever its type. Compile with
+ *  `-ftime-report` (GCC) or `-ftime-trace` (Clang) to compare the two.
+ *  Both return 0 if they detect the operators of every other type.
+ */
+
+#include "synthetic.h"
+#include <pycpp/sfinae/has_op.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace bench
+{
+// MACROS
+// ------
+
+#if defined(PYCPP_BENCH_OVERLOAD)
+
+#define PYCPP_BENCH_OPERATION(name, op)                                         \
+    template <typename T, typename U = T>                                       \
+    struct has_##name                                                           \
+    {                                                                           \
+    protected:                                                                  \
+        template <typename T1 = T, typename U1 = U>                             \
+        static                                                                  \
+        char&                                                                   \
+        test(decltype(void(decl_lvalue<T1>() op declval<U1>()))*);              \
+                                                                                \
+        template <typename T1 = T, typename U1 = U>                             \
+        static                                                                  \
+        long&                                                                   \
+        test(...);                                                              \
+                                                                                \
+    public:                                                                     \
+        enum {                                                                  \
+            value = sizeof(test<T, U>(nullptr)) == sizeof(char)                 \
+        };                                                                      \
+    }
+
+#else
+
+#define PYCPP_BENCH_OPERATION(name, op) PYCPP_HAS_OPERATION(name, op)
+
+#endif
+
+// SFINAE
+// ------
+
+PYCPP_BENCH_OPERATION(plus, +);
+PYCPP_BENCH_OPERATION(plus_assign, +=);
+PYCPP_BENCH_OPERATION(less, <);
+PYCPP_BENCH_OPERATION(equal_to, ==);
+PYCPP_BENCH_OPERATION(left_shift, <<);
+
+// FUNCTIONS
+// ---------
+
+template <size_t... Is>
+size_t count(index_sequence<Is...>)
+{
+    constexpr bool values[] = {
+        (has_plus<synthetic<Is>>::value &&
+         has_plus_assign<synthetic<Is>>::value &&
+         has_less<synthetic<Is>>::value &&
+         has_equal_to<synthetic<Is>>::value &&
+         has_left_shift<synthetic<Is>>::value)...
+    };
+
+    size_t n = 0;
+    for (bool value: values) {
+        n += value;
+    }
+    return n;
+}
+
+}   /* bench */
+
+PYCPP_END_NAMESPACE
+
+int main()
+{
+    using namespace PYCPP_NAMESPACE;
+    size_t n = bench::count(make_index_sequence<PYCPP_BENCH_TYPES>());
+    return n != (PYCPP_BENCH_TYPES + 1) / 2;
+}
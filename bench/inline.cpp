@@ -0,0 +1,122 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Debug-build benchmark for the functor call overhead.
+ *
+ *  Fills and drains a `vector` with `push_back`, `back` and
+ *  `pop_back`, and a `deque` with `push_front`, `front` and
+ *  `pop_front`, through the functors and through the member
+ *  functions directly. Build without optimizations, once with and
+ *  once without `PYCPP_SFINAE_FORCE_INLINE`, and compare the
+ *  functor times to the direct times.
+ */
+
+#include <pycpp/sfinae/back.h>
+#include <pycpp/sfinae/front.h>
+#include <pycpp/sfinae/pop_back.h>
+#include <pycpp/sfinae/pop_front.h>
+#include <pycpp/sfinae/push_back.h>
+#include <pycpp/sfinae/push_front.h>
+#include <pycpp/stl/deque.h>
+#include <pycpp/stl/vector.h>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifndef PYCPP_BENCH_ITERATIONS
+#   define PYCPP_BENCH_ITERATIONS 1000000
+#endif
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace bench
+{
+// FUNCTIONS
+// ---------
+
+template <typename F>
+double
+time(
+    F f
+)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void
+report(
+    const char* name,
+    double direct,
+    double functor
+)
+{
+    printf("%-8s direct: %10.3f ms, functor: %10.3f ms, overhead: %.2fx\n", name, direct, functor, functor / direct);
+}
+
+}   /* bench */
+
+PYCPP_END_NAMESPACE
+
+int main()
+{
+    using namespace PYCPP_NAMESPACE;
+    using namespace PYCPP_NAMESPACE::bench;
+
+    const int n = PYCPP_BENCH_ITERATIONS;
+    int64_t sink = 0;
+
+#if defined(PYCPP_SFINAE_FORCE_INLINE)
+    printf("PYCPP_SFINAE_FORCE_INLINE: on\n");
+#else
+    printf("PYCPP_SFINAE_FORCE_INLINE: off\n");
+#endif
+
+    vector<int> v;
+    v.reserve(n);
+    double vector_direct = bench::time([&]() {
+        for (int i = 0; i < n; ++i) {
+            v.push_back(i);
+        }
+        while (!v.empty()) {
+            sink += v.back();
+            v.pop_back();
+        }
+    });
+    double vector_functor = bench::time([&]() {
+        for (int i = 0; i < n; ++i) {
+            push_back()(v, i);
+        }
+        while (!v.empty()) {
+            sink += back()(v);
+            pop_back()(v);
+        }
+    });
+    report("vector", vector_direct, vector_functor);
+
+    deque<int> d;
+    double deque_direct = bench::time([&]() {
+        for (int i = 0; i < n; ++i) {
+            d.push_front(i);
+        }
+        while (!d.empty()) {
+            sink += d.front();
+            d.pop_front();
+        }
+    });
+    double deque_functor = bench::time([&]() {
+        for (int i = 0; i < n; ++i) {
+            push_front()(d, i);
+        }
+        while (!d.empty()) {
+            sink += front()(d);
+            pop_front()(d);
+        }
+    });
+    report("deque", deque_direct, deque_functor);
+
+    return sink == 0;
+}
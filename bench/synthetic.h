@@ -0,0 +1,91 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Synthetic types for compile-time benchmarks.
+ *
+ *  Every other synthetic type supports the arithmetic, comparison
+ *  and shift operators, so both the success and failure paths of
+ *  each detector are instantiated.
+ */
+
+#pragma once
+
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
+#include <stddef.h>
+
+#ifndef PYCPP_BENCH_TYPES
+#   define PYCPP_BENCH_TYPES 200
+#endif
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace bench
+{
+// OBJECTS
+// -------
+
+template <size_t N>
+struct synthetic
+{};
+
+// MACROS
+// ------
+
+#define PYCPP_BENCH_BINARY(op)                                                  \
+    template <size_t N>                                                         \
+    enable_if_t<N % 2 == 0, synthetic<N>>                                       \
+    operator op(const synthetic<N>&, const synthetic<N>&)
+
+#define PYCPP_BENCH_ASSIGN(op)                                                  \
+    template <size_t N>                                                         \
+    enable_if_t<N % 2 == 0, synthetic<N>&>                                      \
+    operator op(synthetic<N>&, const synthetic<N>&)
+
+#define PYCPP_BENCH_COMPARE(op)                                                 \
+    template <size_t N>                                                         \
+    enable_if_t<N % 2 == 0, bool>                                               \
+    operator op(const synthetic<N>&, const synthetic<N>&)
+
+// OPERATORS
+// ---------
+
+PYCPP_BENCH_BINARY(+);
+PYCPP_BENCH_BINARY(-);
+PYCPP_BENCH_BINARY(*);
+PYCPP_BENCH_BINARY(/);
+PYCPP_BENCH_BINARY(%);
+PYCPP_BENCH_BINARY(&);
+PYCPP_BENCH_BINARY(|);
+PYCPP_BENCH_BINARY(^);
+PYCPP_BENCH_BINARY(<<);
+PYCPP_BENCH_BINARY(>>);
+
+PYCPP_BENCH_ASSIGN(+=);
+PYCPP_BENCH_ASSIGN(-=);
+PYCPP_BENCH_ASSIGN(*=);
+PYCPP_BENCH_ASSIGN(/=);
+PYCPP_BENCH_ASSIGN(%=);
+PYCPP_BENCH_ASSIGN(&=);
+PYCPP_BENCH_ASSIGN(|=);
+PYCPP_BENCH_ASSIGN(^=);
+PYCPP_BENCH_ASSIGN(<<=);
+PYCPP_BENCH_ASSIGN(>>=);
+
+PYCPP_BENCH_COMPARE(==);
+PYCPP_BENCH_COMPARE(!=);
+PYCPP_BENCH_COMPARE(<);
+PYCPP_BENCH_COMPARE(<=);
+PYCPP_BENCH_COMPARE(>);
+PYCPP_BENCH_COMPARE(>=);
+PYCPP_BENCH_COMPARE(&&);
+PYCPP_BENCH_COMPARE(||);
+
+#undef PYCPP_BENCH_BINARY
+#undef PYCPP_BENCH_ASSIGN
+#undef PYCPP_BENCH_COMPARE
+
+}   /* bench */
+
+PYCPP_END_NAMESPACE
@@ -0,0 +1,18 @@
+#  :copyright: (c) 2017-2018 Alex Huszagh.
+#  :license: MIT, see licenses/mit.md for more details.
+
+# Compile a single benchmark translation unit, writing the compiler's
+# timing report to `OUTPUT`. Invoked with `cmake -P`, with `COMPILER`,
+# `FLAGS`, `SOURCE`, `OBJECT` and `OUTPUT` defined.
+
+separate_arguments(FLAGS)
+execute_process(
+    COMMAND ${COMPILER} ${FLAGS} -c ${SOURCE} -o ${OBJECT}
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE stdout
+    ERROR_FILE ${OUTPUT}
+)
+if(NOT result EQUAL 0)
+    file(READ ${OUTPUT} stderr)
+    message(FATAL_ERROR "Unable to compile ${SOURCE}:\n${stderr}")
+endif()
@@ -0,0 +1,505 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Element-wise complex arithmetic over ranges.
+ *
+ *  Multiply, multiply-accumulate, conjugate-multiply, and take the
+ *  magnitude of ranges of `std::complex`, or other complex-like types
+ *  (see `is_complex_like`). By default, each item is calculated with
+ *  the type's operators, which for `std::complex` recover infinities
+ *  from NaN results (C99 Annex G), and cannot be vectorized. Other
+ *  complex-like types then need `operator*` and `operator+=`, and
+ *  `conj` and `abs` found by argument-dependent lookup; types without
+ *  them must pass `fast_complex_t`, which only uses `real()` and
+ *  `imag()`.
+ *
+ *  Passing `fast_complex_t`, or defining `PYCPP_SFINAE_FAST_COMPLEX`
+ *  to make it the default, uses the textbook formulas instead, without
+ *  NaN and infinity recovery and, for the magnitude, without guarding
+ *  against overflow. Contiguous ranges of the same complex type, opted
+ *  in with `is_interleaved_complex`, then use a vectorizable kernel over
+ *  the interleaved real and imaginary parts, compiled for the best instruction set the CPU supports (see
+ *  `vectorize.h`).
+ *
+ *  \synopsis
+ *      struct fast_complex_t {};
+ *
+ *      struct complex_multiply
+ *      {
+ *          template <typename Dst, typename A, typename B>
+ *          void operator()(Dst& dst, const A& a, const B& b) const;
+ *
+ *          template <typename Dst, typename A, typename B>
+ *          void operator()(Dst& dst, const A& a, const B& b, fast_complex_t) const;
+ *      };
+ *
+ *      struct complex_multiply_accumulate
+ *      {
+ *          template <typename Dst, typename A, typename B>
+ *          void operator()(Dst& dst, const A& a, const B& b) const;
+ *
+ *          template <typename Dst, typename A, typename B>
+ *          void operator()(Dst& dst, const A& a, const B& b, fast_complex_t) const;
+ *      };
+ *
+ *      struct complex_conj_multiply
+ *      {
+ *          template <typename Dst, typename A, typename B>
+ *          void operator()(Dst& dst, const A& a, const B& b) const;
+ *
+ *          template <typename Dst, typename A, typename B>
+ *          void operator()(Dst& dst, const A& a, const B& b, fast_complex_t) const;
+ *      };
+ *
+ *      struct complex_magnitude
+ *      {
+ *          template <typename Dst, typename A>
+ *          void operator()(Dst& dst, const A& a) const;
+ *
+ *          template <typename Dst, typename A>
+ *          void operator()(Dst& dst, const A& a, fast_complex_t) const;
+ *      };
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/elementwise.h>
+#include <pycpp/sfinae/is_complex_like.h>
+#include <pycpp/sfinae/is_contiguous_container.h>
+#include <pycpp/sfinae/vectorize.h>
+#include <pycpp/stl/complex.h>
+#include <pycpp/stl/iterator.h>
+#include <pycpp/stl/type_traits.h>
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+// POLICIES
+// --------
+
+/**
+ *  \brief Use the textbook complex formulas, without NaN and
+ *  infinity recovery.
+ */
+struct fast_complex_t
+{};
+
+namespace complex_detail
+{
+// SFINAE
+// ------
+
+template <typename T>
+using value_t = elementwise_detail::value_t<T>;
+
+template <typename T>
+using contiguous_value_t = elementwise_detail::contiguous_value_t<T>;
+
+template <typename T, typename = void>
+struct scalar
+{
+    using type = void;
+};
+
+template <typename T>
+struct scalar<T, enable_if_t<is_complex_like<T>::value>>
+{
+    using type = complex_value_t<T>;
+};
+
+template <typename T>
+using scalar_t = typename scalar<T>::type;
+
+/**
+ *  Only view types opted in with `is_interleaved_complex` as
+ *  interleaved parts, and check the opt-in matches the size.
+ */
+template <typename T>
+using is_interleaved = bool_constant<
+    is_interleaved_complex<T>::value &&
+    complex_like_detail::has_layout<T>::value
+>;
+
+/**
+ *  Use the interleaved kernel if every range is contiguous, with
+ *  the same interleaved value type, and the destination is mutable.
+ */
+template <typename Dst, typename A, typename B>
+using use_kernel = bool_constant<
+    is_interleaved<contiguous_value_t<Dst>>::value &&
+    elementwise_detail::contiguous_value<Dst>::is_mutable &&
+    is_same<contiguous_value_t<Dst>, contiguous_value_t<const A>>::value &&
+    is_same<contiguous_value_t<Dst>, contiguous_value_t<const B>>::value
+>;
+
+/**
+ *  Use the interleaved kernel if both ranges are contiguous, and the
+ *  destination holds the scalar type of the complex-like source.
+ */
+template <typename Dst, typename A>
+using use_magnitude_kernel = bool_constant<
+    is_interleaved<contiguous_value_t<const A>>::value &&
+    elementwise_detail::contiguous_value<Dst>::is_mutable &&
+    is_same<contiguous_value_t<Dst>, scalar_t<contiguous_value_t<const A>>>::value
+>;
+
+// FUNCTIONS
+// ---------
+
+/**
+ *  Call `f(i)` for each index in `[0, n)`, split into blocks with a
+ *  known trip count, so the inner loop is vectorized, and compiled
+ *  for the best supported instruction set.
+ */
+template <typename T, typename F>
+void
+loop(
+    size_t n,
+    F f
+)
+{
+    vectorize_detail::dispatch([=]() {
+        constexpr size_t block = sizeof(T) < 32 ? 32 / sizeof(T) : 1;
+        size_t i = 0;
+        for (; i + block <= n; i += block) {
+            PYCPP_SFINAE_DETAIL_VECTORIZE
+            for (size_t j = i; j < i + block; ++j) {
+                f(j);
+            }
+        }
+        for (; i < n; ++i) {
+            f(i);
+        }
+    });
+}
+
+/**
+ *  View a contiguous range of complex-like items as interleaved
+ *  parts, which `is_interleaved_complex` guarantees is layout-compatible.
+ */
+template <typename Range>
+auto
+interleaved(
+    Range &r
+)
+-> decltype(reinterpret_cast<scalar_t<contiguous_value_t<Range>>*>(as_span()(r).data()))
+{
+    return reinterpret_cast<scalar_t<contiguous_value_t<Range>>*>(as_span()(r).data());
+}
+
+template <typename Range>
+auto
+interleaved(
+    const Range &r
+)
+-> decltype(reinterpret_cast<const scalar_t<contiguous_value_t<const Range>>*>(as_span()(r).data()))
+{
+    return reinterpret_cast<const scalar_t<contiguous_value_t<const Range>>*>(as_span()(r).data());
+}
+
+// OPERATIONS
+// ----------
+
+struct multiply
+{
+    template <typename T>
+    static void apply(T& dr, T& di, T xr, T xi, T yr, T yi)
+    {
+        dr = xr*yr - xi*yi;
+        di = xr*yi + xi*yr;
+    }
+
+    template <typename C>
+    static void strict(C& d, const C& x, const C& y)
+    {
+        d = x * y;
+    }
+};
+
+struct multiply_accumulate
+{
+    template <typename T>
+    static void apply(T& dr, T& di, T xr, T xi, T yr, T yi)
+    {
+        dr += xr*yr - xi*yi;
+        di += xr*yi + xi*yr;
+    }
+
+    template <typename C>
+    static void strict(C& d, const C& x, const C& y)
+    {
+        d += x * y;
+    }
+};
+
+struct conj_multiply
+{
+    template <typename T>
+    static void apply(T& dr, T& di, T xr, T xi, T yr, T yi)
+    {
+        dr = xr*yr + xi*yi;
+        di = xi*yr - xr*yi;
+    }
+
+    template <typename C>
+    static void strict(C& d, const C& x, const C& y)
+    {
+        d = x * conj(y);
+    }
+};
+
+// OBJECTS
+// -------
+
+/**
+ *  \brief Apply a binary complex operation over ranges.
+ */
+template <typename Op>
+struct binary
+{
+private:
+    template <typename Dst, typename A, typename B>
+    static
+    void
+    loop(
+        Dst &dst,
+        const A &a,
+        const B &b
+    )
+    {
+        using value_type = value_t<Dst>;
+        using scalar_type = scalar_t<value_type>;
+        auto d = begin(dst);
+        auto y = begin(b);
+        for (auto x = begin(a), last = end(a); x != last; ++x, ++y, ++d) {
+            scalar_type dr = d->real();
+            scalar_type di = d->imag();
+            Op::apply(dr, di, scalar_type(x->real()), scalar_type(x->imag()), scalar_type(y->real()), scalar_type(y->imag()));
+            *d = value_type(dr, di);
+        }
+    }
+
+    template <typename Dst, typename A, typename B>
+    static
+    void
+    kernel(
+        Dst &dst,
+        const A &a,
+        const B &b
+    )
+    {
+        using scalar_type = scalar_t<contiguous_value_t<Dst>>;
+        scalar_type* dp = interleaved(dst);
+        const scalar_type* xp = interleaved(a);
+        const scalar_type* yp = interleaved(b);
+        assert(as_span()(dst).size() >= as_span()(a).size());
+        assert(as_span()(b).size() >= as_span()(a).size());
+        complex_detail::loop<scalar_type>(as_span()(a).size(), [=](size_t i) {
+            Op::apply(dp[2*i], dp[2*i+1], xp[2*i], xp[2*i+1], yp[2*i], yp[2*i+1]);
+        });
+    }
+
+public:
+    template <typename Dst, typename A, typename B>
+    void
+    operator()(
+        Dst &dst,
+        const A &a,
+        const B &b
+    )
+    const
+    {
+        static_assert(is_complex_like<value_t<const A>>::value, "Items must be complex.");
+#if defined(PYCPP_SFINAE_FAST_COMPLEX)
+        (*this)(dst, a, b, fast_complex_t());
+#else
+        auto d = begin(dst);
+        auto y = begin(b);
+        for (auto x = begin(a), last = end(a); x != last; ++x, ++y, ++d) {
+            Op::strict(*d, *x, *y);
+        }
+#endif
+    }
+
+#if defined(PYCPP_CPP20)
+    template <typename Dst, typename A, typename B>
+    void
+    operator()(
+        Dst &dst,
+        const A &a,
+        const B &b,
+        fast_complex_t
+    )
+    const
+    {
+        if constexpr (use_kernel<Dst, A, B>::value) {
+            kernel(dst, a, b);
+        } else {
+            static_assert(is_complex_like<value_t<const A>>::value, "Items must be complex.");
+            loop(dst, a, b);
+        }
+    }
+#else
+    template <typename Dst, typename A, typename B>
+    enable_if_t<use_kernel<Dst, A, B>::value, void>
+    operator()(
+        Dst &dst,
+        const A &a,
+        const B &b,
+        fast_complex_t
+    )
+    const
+    {
+        kernel(dst, a, b);
+    }
+
+    template <typename Dst, typename A, typename B>
+    enable_if_t<!use_kernel<Dst, A, B>::value, void>
+    operator()(
+        Dst &dst,
+        const A &a,
+        const B &b,
+        fast_complex_t
+    )
+    const
+    {
+        static_assert(is_complex_like<value_t<const A>>::value, "Items must be complex.");
+        loop(dst, a, b);
+    }
+#endif
+};
+
+}   /* complex_detail */
+
+
+/**
+ *  \brief Calculate `dst[i] = a[i] * b[i]` as a functor.
+ */
+struct complex_multiply: complex_detail::binary<complex_detail::multiply>
+{};
+
+
+/**
+ *  \brief Calculate `dst[i] += a[i] * b[i]` as a functor.
+ */
+struct complex_multiply_accumulate: complex_detail::binary<complex_detail::multiply_accumulate>
+{};
+
+
+/**
+ *  \brief Calculate `dst[i] = a[i] * conj(b[i])` as a functor.
+ */
+struct complex_conj_multiply: complex_detail::binary<complex_detail::conj_multiply>
+{};
+
+
+/**
+ *  \brief Calculate `dst[i] = abs(a[i])` as a functor.
+ *
+ *  The fast mode calculates `sqrt(re*re + im*im)`, which may overflow
+ *  or underflow for large or small parts, rather than `hypot`.
+ */
+struct complex_magnitude
+{
+private:
+    template <typename Dst, typename A>
+    static
+    void
+    loop(
+        Dst &dst,
+        const A &a
+    )
+    {
+        auto d = begin(dst);
+        for (auto x = begin(a), last = end(a); x != last; ++x, ++d) {
+            *d = sqrt(x->real()*x->real() + x->imag()*x->imag());
+        }
+    }
+
+    template <typename Dst, typename A>
+    static
+    void
+    kernel(
+        Dst &dst,
+        const A &a
+    )
+    {
+        using scalar_type = complex_detail::contiguous_value_t<Dst>;
+        scalar_type* dp = as_span()(dst).data();
+        const scalar_type* xp = complex_detail::interleaved(a);
+        assert(as_span()(dst).size() >= as_span()(a).size());
+        complex_detail::loop<scalar_type>(as_span()(a).size(), [=](size_t i) {
+            dp[i] = sqrt(xp[2*i]*xp[2*i] + xp[2*i+1]*xp[2*i+1]);
+        });
+    }
+
+public:
+    template <typename Dst, typename A>
+    void
+    operator()(
+        Dst &dst,
+        const A &a
+    )
+    const
+    {
+        static_assert(is_complex_like<complex_detail::value_t<const A>>::value, "Items must be complex.");
+#if defined(PYCPP_SFINAE_FAST_COMPLEX)
+        (*this)(dst, a, fast_complex_t());
+#else
+        auto d = begin(dst);
+        for (auto x = begin(a), last = end(a); x != last; ++x, ++d) {
+            *d = abs(*x);
+        }
+#endif
+    }
+
+#if defined(PYCPP_CPP20)
+    template <typename Dst, typename A>
+    void
+    operator()(
+        Dst &dst,
+        const A &a,
+        fast_complex_t
+    )
+    const
+    {
+        if constexpr (complex_detail::use_magnitude_kernel<Dst, A>::value) {
+            kernel(dst, a);
+        } else {
+            static_assert(is_complex_like<complex_detail::value_t<const A>>::value, "Items must be complex.");
+            loop(dst, a);
+        }
+    }
+#else
+    template <typename Dst, typename A>
+    enable_if_t<complex_detail::use_magnitude_kernel<Dst, A>::value, void>
+    operator()(
+        Dst &dst,
+        const A &a,
+        fast_complex_t
+    )
+    const
+    {
+        kernel(dst, a);
+    }
+
+    template <typename Dst, typename A>
+    enable_if_t<!complex_detail::use_magnitude_kernel<Dst, A>::value, void>
+    operator()(
+        Dst &dst,
+        const A &a,
+        fast_complex_t
+    )
+    const
+    {
+        static_assert(is_complex_like<complex_detail::value_t<const A>>::value, "Items must be complex.");
+        loop(dst, a);
+    }
+#endif
+};
+
+PYCPP_END_NAMESPACE
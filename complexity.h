@@ -0,0 +1,356 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Asymptotic cost of the path selected by each functor.
+ *
+ *  `complexity<Functor, T>` reports the cost of calling `Functor` on
+ *  a container of type `T`, as a function of the container size. The
+ *  native member functions are constant, while the fallbacks depend
+ *  on the container: `pop_front` on a `vector` erases the first item
+ *  and is linear, and `back` on a `set` decrements the end iterator
+ *  and is logarithmic. Amortized costs are reported as the amortized
+ *  cost.
+ *
+ *  The batch functors exclude the cost linear in the number of items.
+ *  Removing items from the front of a `vector` with `pop_front_n`
+ *  moves the remaining items once, and is linear. Items appended by
+ *  `extend` are assumed to be a range of pointers to `value_type`.
+ *  `reserve` and `shrink_to_fit` may reallocate, and are linear if
+ *  the container supports them, but the strict mode only checks the
+ *  fallbacks of the single-item functors.
+ *
+ *  Containers are classified by their member types: ordered
+ *  associative containers define `key_compare`, unordered
+ *  associative containers define `hasher`, and sequences with
+ *  random-access iterators shift items on insertion or erasure.
+ *
+ *  The policy, `allow_fallback_t`, and the strict mode are declared
+ *  in `fallback.h`, which each functor includes. The costs are only
+ *  defined here, and the functor headers only include this header
+ *  if `PYCPP_SFINAE_STRICT_COMPLEXITY` is defined.
+ *
+ *  \synopsis
+ *      template <typename T>
+ *      struct complexity<back, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<front, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<push_back, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<push_front, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<emplace_back, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<emplace_front, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<pop_back, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<pop_front, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<pop_front_n, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<pop_back_n, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<extend, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<reserve, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      template <typename T>
+ *      struct complexity<shrink_to_fit, T>: integral_constant<complexity_class, implementation-defined>
+ *      {};
+ *
+ *      #if PYCPP_CPP14
+ *
+ *      template <typename Functor, typename T>
+ *      constexpr complexity_class complexity_v = implementation-defined;
+ *
+ *      #endif
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/back.h>
+#include <pycpp/sfinae/container_traits.h>
+#include <pycpp/sfinae/emplace_back.h>
+#include <pycpp/sfinae/emplace_front.h>
+#include <pycpp/sfinae/extend.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/front.h>
+#include <pycpp/sfinae/pop_back.h>
+#include <pycpp/sfinae/pop_front.h>
+#include <pycpp/sfinae/pop_n.h>
+#include <pycpp/sfinae/push_back.h>
+#include <pycpp/sfinae/push_front.h>
+#include <pycpp/sfinae/reserve.h>
+#include <pycpp/sfinae/shrink_to_fit.h>
+#include <pycpp/stl/iterator.h>
+#include <pycpp/stl/type_traits.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace complexity_detail
+{
+// SFINAE
+// ------
+
+template <complexity_class C>
+using complexity_constant = integral_constant<complexity_class, C>;
+
+template <typename T, typename = void>
+struct is_ordered: false_type
+{};
+
+template <typename T>
+struct is_ordered<T, void_t<typename T::key_compare>>: true_type
+{};
+
+template <typename T, typename = void>
+struct is_hashed: false_type
+{};
+
+template <typename T>
+struct is_hashed<T, void_t<typename T::hasher>>: true_type
+{};
+
+template <typename T, typename = void>
+struct is_random_access: false_type
+{};
+
+template <typename T>
+struct is_random_access<T, void_t<typename iterator_traits<typename T::iterator>::iterator_category>>:
+    is_base_of<random_access_iterator_tag, typename iterator_traits<typename T::iterator>::iterator_category>
+{};
+
+/**
+ *  Cost of `insert` at the front or back.
+ */
+template <typename T, bool Front>
+using insert_complexity = complexity_constant<
+    is_hashed<T>::value ? complexity_class::constant :
+    is_ordered<T>::value ? complexity_class::logarithmic :
+    is_random_access<T>::value && Front ? complexity_class::linear :
+    complexity_class::constant
+>;
+
+/**
+ *  Cost of `erase` at the front or back.
+ */
+template <typename T, bool Front>
+using erase_complexity = complexity_constant<
+    !is_hashed<T>::value && !is_ordered<T>::value && is_random_access<T>::value && Front ? complexity_class::linear :
+    complexity_class::constant
+>;
+
+/**
+ *  Cost of dereferencing `rbegin`.
+ */
+template <typename T>
+using rbegin_complexity = complexity_constant<
+    is_ordered<T>::value ? complexity_class::logarithmic : complexity_class::constant
+>;
+
+/**
+ *  Constant for the native call, otherwise the cost of the fallback.
+ */
+template <bool Native, typename Fallback>
+using select = conditional_t<Native, complexity_constant<complexity_class::constant>, Fallback>;
+
+/**
+ *  Cost of range `erase` at the front. Containers with a native
+ *  `pop_front` erase the front without moving the remaining items.
+ */
+template <typename T>
+using front_range_erase_complexity = select<
+    container_traits<T>::has_pop_front,
+    erase_complexity<T, true>
+>;
+
+/**
+ *  Cost of the range insertion selected by `extend`, per item.
+ */
+template <typename T, typename It = const typename T::value_type*>
+using extend_complexity = conditional_t<
+    extend_detail::use_append<T, It>::value || extend_detail::use_range_insert<T, It>::value,
+    complexity_constant<complexity_class::constant>,
+    conditional_t<
+        extend_detail::use_unpositioned_range_insert<T, It>::value,
+        insert_complexity<T, false>,
+        complexity<push_back, T>
+    >
+>;
+
+/**
+ *  Linear if the call may reallocate, otherwise a no-op.
+ */
+template <bool Reallocates>
+using reallocation_complexity = complexity_constant<
+    Reallocates ? complexity_class::linear : complexity_class::constant
+>;
+
+}   /* complexity_detail */
+
+// SFINAE
+// ------
+
+/**
+ *  \brief Cost of the path selected by `back`.
+ */
+template <typename T>
+struct complexity<back, T>: complexity_detail::select<
+        container_traits<remove_const_t<T>>::has_back,
+        complexity_detail::rbegin_complexity<remove_const_t<T>>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `emplace_back`.
+ */
+template <typename T>
+struct complexity<emplace_back, T>: complexity_detail::select<
+        container_traits<T>::has_emplace_back,
+        complexity_detail::insert_complexity<T, false>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `emplace_front`.
+ */
+template <typename T>
+struct complexity<emplace_front, T>: complexity_detail::select<
+        container_traits<T>::has_emplace_front,
+        complexity_detail::insert_complexity<T, true>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `front`.
+ */
+template <typename T>
+struct complexity<front, T>: complexity_detail::select<
+        container_traits<remove_const_t<T>>::has_front,
+        complexity_detail::complexity_constant<complexity_class::constant>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `pop_back`.
+ */
+template <typename T>
+struct complexity<pop_back, T>: complexity_detail::select<
+        container_traits<T>::has_pop_back,
+        complexity_detail::erase_complexity<T, false>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `pop_front`.
+ */
+template <typename T>
+struct complexity<pop_front, T>: complexity_detail::select<
+        container_traits<T>::has_pop_front,
+        complexity_detail::erase_complexity<T, true>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `push_back`.
+ */
+template <typename T>
+struct complexity<push_back, T>: complexity_detail::select<
+        container_traits<T>::has_push_back,
+        complexity_detail::insert_complexity<T, false>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `push_front`.
+ */
+template <typename T>
+struct complexity<push_front, T>: complexity_detail::select<
+        container_traits<T>::has_push_front,
+        complexity_detail::insert_complexity<T, true>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `pop_front_n`.
+ */
+template <typename T>
+struct complexity<pop_front_n, T>: conditional_t<
+        pop_n_detail::use_front_range_erase<T>::value,
+        complexity_detail::front_range_erase_complexity<T>,
+        complexity<pop_front, T>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `pop_back_n`.
+ */
+template <typename T>
+struct complexity<pop_back_n, T>: complexity_detail::select<
+        pop_n_detail::use_back_range_erase<T>::value || pop_n_detail::use_resize<T>::value,
+        complexity<pop_back, T>
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `extend`, per item.
+ */
+template <typename T>
+struct complexity<extend, T>: complexity_detail::extend_complexity<T>
+{};
+
+/**
+ *  \brief Cost of the path selected by `reserve`.
+ */
+template <typename T>
+struct complexity<reserve, T>: complexity_detail::reallocation_complexity<
+        reserve_detail::is_reservable<T>::value
+    >
+{};
+
+/**
+ *  \brief Cost of the path selected by `shrink_to_fit`.
+ */
+template <typename T>
+struct complexity<shrink_to_fit, T>: complexity_detail::reallocation_complexity<
+        container_traits<T>::has_shrink_to_fit
+    >
+{};
+
+#ifdef PYCPP_CPP14
+
+// SFINAE
+// ------
+
+template <typename Functor, typename T>
+constexpr complexity_class complexity_v = complexity<Functor, T>::value;
+
+#endif
+
+PYCPP_END_NAMESPACE
@@ -0,0 +1,155 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Single-allocation string concatenation.
+ *
+ *  Concatenate any mix of string-like values (see `is_string_like`),
+ *  or join a forward range of string-like values with a separator. The
+ *  total length is calculated first, so the result is allocated once,
+ *  with `reserve`, and each value is then copied into it. Character
+ *  arrays are sized as buffers, up to the first null character, as
+ *  with `string_size`.
+ *
+ *  \synopsis
+ *      struct concat
+ *      {
+ *          template <typename T, typename... Ts>
+ *          basic_string<string_char_t<T>> operator()(T&& t, Ts&&... ts) const;
+ *      };
+ *
+ *      struct join
+ *      {
+ *          template <typename Sep, typename Range>
+ *          basic_string<string_char_t<Sep>> operator()(const Sep& sep, const Range& r) const;
+ *      };
+ */
+
+#pragma once
+
+#include <pycpp/sfinae/all_of.h>
+#include <pycpp/sfinae/is_string_view.h>
+#include <pycpp/sfinae/reserve.h>
+#include <pycpp/stl/iterator.h>
+#include <pycpp/stl/string.h>
+#include <pycpp/stl/string_view.h>
+#include <pycpp/stl/type_traits.h>
+#include <stddef.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace concat_detail
+{
+// SFINAE
+// ------
+
+/**
+ *  `join` sizes the result before copying, which walks the range twice.
+ */
+template <typename Range>
+using is_forward_range = is_base_of<
+    forward_iterator_tag,
+    typename iterator_traits<decltype(begin(declval<const Range&>()))>::iterator_category
+>;
+
+// FUNCTIONS
+// ---------
+
+template <typename C, typename T>
+basic_string_view<C>
+view(
+    T &&t
+)
+{
+    auto v = as_string_view()(t);
+    return basic_string_view<C>(v.data(), v.size());
+}
+
+}   /* concat_detail */
+
+
+/**
+ *  \brief Concatenate string-like values as a functor.
+ *
+ *  Every value must have the same character type.
+ */
+struct concat
+{
+    template <typename T, typename... Ts>
+    basic_string<string_char_t<T>>
+    operator()(
+        T &&t,
+        Ts &&... ts
+    )
+    const
+    {
+        using char_type = string_char_t<T>;
+        static_assert(sfinae_detail::all_of<is_same<char_type, string_char_t<Ts>>::value...>::value, "Strings must have the same character type.");
+
+        basic_string_view<char_type> views[] = {
+            concat_detail::view<char_type>(t),
+            concat_detail::view<char_type>(ts)...
+        };
+        size_t size = 0;
+        for (const auto &view: views) {
+            size += view.size();
+        }
+
+        basic_string<char_type> result;
+        reserve()(result, size);
+        for (const auto &view: views) {
+            result.append(view.data(), view.size());
+        }
+        return result;
+    }
+};
+
+
+/**
+ *  \brief Join a range of string-like values with a separator as a functor.
+ *
+ *  The range must be a forward range, since it is walked once to size
+ *  the result, and once to copy each value.
+ */
+struct join
+{
+    template <typename Sep, typename Range>
+    basic_string<string_char_t<Sep>>
+    operator()(
+        const Sep &sep,
+        const Range &r
+    )
+    const
+    {
+        using char_type = string_char_t<Sep>;
+        static_assert(is_same<char_type, string_char_t<decltype(*begin(r))>>::value, "Strings must have the same character type.");
+        static_assert(concat_detail::is_forward_range<Range>::value, "Range must be a forward range.");
+
+        auto separator = concat_detail::view<char_type>(sep);
+        auto first = begin(r);
+        auto last = end(r);
+        if (first == last) {
+            return basic_string<char_type>();
+        }
+
+        size_t size = 0;
+        size_t count = 0;
+        for (auto it = first; it != last; ++it, ++count) {
+            size += concat_detail::view<char_type>(*it).size();
+        }
+        size += (count - 1) * separator.size();
+
+        basic_string<char_type> result;
+        reserve()(result, size);
+        auto view = concat_detail::view<char_type>(*first);
+        result.append(view.data(), view.size());
+        for (auto it = ++first; it != last; ++it) {
+            view = concat_detail::view<char_type>(*it);
+            result.append(separator.data(), separator.size());
+            result.append(view.data(), view.size());
+        }
+        return result;
+    }
+};
+
+PYCPP_END_NAMESPACE
@@ -0,0 +1,320 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Aggregated SFINAE detection of container capabilities.
+ *
+ *  Detect every container method used by the fail-safe functors in
+ *  a single pass, exposing the results as named booleans and as a
+ *  bitmask of `container_capability` flags. The fail-safe functors
+ *  dispatch on `container_traits`, and each functor header defines
+ *  its `has_*` trait (`has_back` in `back.h`, `has_reserve` in
+ *  `reserve.h`, ...) as an alias of the matching member. Generic code
+ *  using several functors with the same container therefore probes it
+ *  only once. Cv-qualified types share the probes of the unqualified
+ *  type, except for subscripting. In C++20, each probe is a
+ *  `supports_*` concept (`supports_back`, `supports_push_back`, ...).
+ *
+ *  \synopsis
+ *      template <typename T>
+ *      struct has_data: implementation_defined
+ *      {};
+ *
+ *      enum container_capability: uint32_t
+ *      {
+ *          container_back          = implementation-defined,
+ *          container_front         = implementation-defined,
+ *          container_push_back     = implementation-defined,
+ *          container_push_front    = implementation-defined,
+ *          container_pop_back      = implementation-defined,
+ *          container_pop_front     = implementation-defined,
+ *          container_emplace_back  = implementation-defined,
+ *          container_emplace_front = implementation-defined,
+ *          container_reserve       = implementation-defined,
+ *          container_shrink_to_fit = implementation-defined,
+ *          container_subscript     = implementation-defined,
+ *          container_contiguous    = implementation-defined,
+ *          container_capacity      = implementation-defined,
+ *          container_rehash        = implementation-defined,
+ *          container_bucket_count  = implementation-defined,
+ *      };
+ *
+ *      template <typename T>
+ *      struct container_traits
+ *      {
+ *          static constexpr uint32_t capabilities = implementation-defined;
+ *          static constexpr bool has_back = implementation-defined;
+ *          static constexpr bool has_front = implementation-defined;
+ *          static constexpr bool has_push_back = implementation-defined;
+ *          static constexpr bool has_push_front = implementation-defined;
+ *          static constexpr bool has_pop_back = implementation-defined;
+ *          static constexpr bool has_pop_front = implementation-defined;
+ *          static constexpr bool has_emplace_back = implementation-defined;
+ *          static constexpr bool has_emplace_front = implementation-defined;
+ *          static constexpr bool has_reserve = implementation-defined;
+ *          static constexpr bool has_capacity = implementation-defined;
+ *          static constexpr bool has_rehash = implementation-defined;
+ *          static constexpr bool has_bucket_count = implementation-defined;
+ *          static constexpr bool has_shrink_to_fit = implementation-defined;
+ *          static constexpr bool has_subscript = implementation-defined;
+ *          static constexpr bool is_contiguous = implementation-defined;
+ *      };
+ *
+ *      #if PYCPP_CPP20
+ *
+ *      template <typename C>
+ *      concept supports_back = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_front = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_push_back = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_push_front = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_pop_back = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_pop_front = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_emplace_back = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_emplace_front = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_reserve = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_capacity = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_rehash = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_bucket_count = implementation-defined;
+ *
+ *      template <typename C>
+ *      concept supports_shrink_to_fit = implementation-defined;
+ *
+ *      #endif
+ *
+ *      #if PYCPP_CPP14
+ *
+ *      template <typename T>
+ *      constexpr bool has_data_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr uint32_t container_capabilities_v = implementation-defined;
+ *
+ *      #endif
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/has_member_function.h>
+#include <pycpp/sfinae/has_subscript.h>
+#include <pycpp/sfinae/is_contiguous_container.h>
+#include <pycpp/stl/type_traits.h>
+#include <stdint.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+// SFINAE
+// ------
+
+PYCPP_HAS_MEMBER_FUNCTION(data, has_data, typename C::const_pointer (C::*)() const);
+
+// OBJECTS
+// -------
+
+/**
+ *  \brief Flags for each capability detected by `container_traits`.
+ */
+enum container_capability: uint32_t
+{
+    container_back          = 1U << 0,
+    container_front         = 1U << 1,
+    container_push_back     = 1U << 2,
+    container_push_front    = 1U << 3,
+    container_pop_back      = 1U << 4,
+    container_pop_front     = 1U << 5,
+    container_emplace_back  = 1U << 6,
+    container_emplace_front = 1U << 7,
+    container_reserve       = 1U << 8,
+    container_shrink_to_fit = 1U << 9,
+    container_subscript     = 1U << 10,
+    container_contiguous    = 1U << 11,
+    container_capacity      = 1U << 12,
+    container_rehash        = 1U << 13,
+    container_bucket_count  = 1U << 14,
+};
+
+// SFINAE
+// ------
+
+// C++17 changed the return type from `void` to `reference`.
+#if defined(PYCPP_CPP17)
+#   define PYCPP_EMPLACE typename C::reference (C::*)(typename C::value_type&&)
+#else
+#   define PYCPP_EMPLACE void (C::*)(typename C::value_type&&)
+#endif
+
+#if defined(PYCPP_CPP20)
+
+/**
+ *  Define the `supports_##member` concept, which matches the exact
+ *  signature like `PYCPP_HAS_MEMBER_FUNCTION`, and the probe used by
+ *  `container_traits`, which derives from the concept.
+ */
+#define PYCPP_CONTAINER_PROBE(member, signature)                                \
+    template <typename C>                                                       \
+    concept supports_##member = requires {                                      \
+        typename integral_constant<signature, &C::member>;                      \
+    };                                                                          \
+                                                                                \
+    namespace container_detail                                                  \
+    {                                                                           \
+    template <typename T>                                                       \
+    using has_##member = bool_constant<supports_##member<T>>;                   \
+    }
+
+#else
+
+#define PYCPP_CONTAINER_PROBE(member, signature)                                \
+    namespace container_detail                                                  \
+    {                                                                           \
+    PYCPP_HAS_MEMBER_FUNCTION(member, has_##member, signature);                 \
+    }
+
+#endif
+
+PYCPP_CONTAINER_PROBE(back, typename C::reference (C::*)())
+PYCPP_CONTAINER_PROBE(front, typename C::reference (C::*)())
+PYCPP_CONTAINER_PROBE(push_back, void (C::*)(typename C::const_reference))
+PYCPP_CONTAINER_PROBE(push_front, void (C::*)(typename C::const_reference))
+PYCPP_CONTAINER_PROBE(pop_back, void (C::*)())
+PYCPP_CONTAINER_PROBE(pop_front, void (C::*)())
+PYCPP_CONTAINER_PROBE(emplace_back, PYCPP_EMPLACE)
+PYCPP_CONTAINER_PROBE(emplace_front, PYCPP_EMPLACE)
+PYCPP_CONTAINER_PROBE(reserve, void (C::*)(typename C::size_type))
+PYCPP_CONTAINER_PROBE(capacity, typename C::size_type (C::*)() const)
+PYCPP_CONTAINER_PROBE(rehash, void (C::*)(typename C::size_type))
+PYCPP_CONTAINER_PROBE(bucket_count, typename C::size_type (C::*)() const)
+PYCPP_CONTAINER_PROBE(shrink_to_fit, void (C::*)())
+
+#undef PYCPP_CONTAINER_PROBE
+#undef PYCPP_EMPLACE
+
+namespace container_detail
+{
+// SFINAE
+// ------
+
+template <typename T, typename = void>
+struct has_size_type_subscript: false_type
+{};
+
+template <typename T>
+struct has_size_type_subscript<T, void_t<typename T::size_type>>:
+    bool_constant<has_subscript<T&, typename T::size_type>::value>
+{};
+
+/**
+ *  Probe every method of `T` at once, except subscripting, which
+ *  depends on the cv-qualifiers.
+ */
+template <typename T>
+struct capabilities: integral_constant<uint32_t,
+        (has_back<T>::value ? container_back : 0U) |
+        (has_front<T>::value ? container_front : 0U) |
+        (has_push_back<T>::value ? container_push_back : 0U) |
+        (has_push_front<T>::value ? container_push_front : 0U) |
+        (has_pop_back<T>::value ? container_pop_back : 0U) |
+        (has_pop_front<T>::value ? container_pop_front : 0U) |
+        (has_emplace_back<T>::value ? container_emplace_back : 0U) |
+        (has_emplace_front<T>::value ? container_emplace_front : 0U) |
+        (has_reserve<T>::value ? container_reserve : 0U) |
+        (has_shrink_to_fit<T>::value ? container_shrink_to_fit : 0U) |
+        (is_contiguous_container<T>::value ? container_contiguous : 0U) |
+        (has_capacity<T>::value ? container_capacity : 0U) |
+        (has_rehash<T>::value ? container_rehash : 0U) |
+        (has_bucket_count<T>::value ? container_bucket_count : 0U)
+    >
+{};
+
+}   /* container_detail */
+
+/**
+ *  \brief Detect all container capabilities at once.
+ *
+ *  Every member is read from `capabilities`, which probes each
+ *  method once per unqualified container type.
+ */
+template <typename T>
+struct container_traits
+{
+    static constexpr uint32_t capabilities = (
+        container_detail::capabilities<remove_cv_t<T>>::value |
+        (container_detail::has_size_type_subscript<T>::value ? container_subscript : 0U)
+    );
+
+    static constexpr bool has_back = (capabilities & container_back) != 0;
+    static constexpr bool has_front = (capabilities & container_front) != 0;
+    static constexpr bool has_push_back = (capabilities & container_push_back) != 0;
+    static constexpr bool has_push_front = (capabilities & container_push_front) != 0;
+    static constexpr bool has_pop_back = (capabilities & container_pop_back) != 0;
+    static constexpr bool has_pop_front = (capabilities & container_pop_front) != 0;
+    static constexpr bool has_emplace_back = (capabilities & container_emplace_back) != 0;
+    static constexpr bool has_emplace_front = (capabilities & container_emplace_front) != 0;
+    static constexpr bool has_reserve = (capabilities & container_reserve) != 0;
+    static constexpr bool has_capacity = (capabilities & container_capacity) != 0;
+    static constexpr bool has_rehash = (capabilities & container_rehash) != 0;
+    static constexpr bool has_bucket_count = (capabilities & container_bucket_count) != 0;
+    static constexpr bool has_shrink_to_fit = (capabilities & container_shrink_to_fit) != 0;
+    static constexpr bool has_subscript = (capabilities & container_subscript) != 0;
+    static constexpr bool is_contiguous = (capabilities & container_contiguous) != 0;
+};
+
+#if !defined(PYCPP_CPP17)
+
+// Out-of-line definitions, required prior to C++17 if odr-used.
+
+template <typename T> constexpr uint32_t container_traits<T>::capabilities;
+template <typename T> constexpr bool container_traits<T>::has_back;
+template <typename T> constexpr bool container_traits<T>::has_front;
+template <typename T> constexpr bool container_traits<T>::has_push_back;
+template <typename T> constexpr bool container_traits<T>::has_push_front;
+template <typename T> constexpr bool container_traits<T>::has_pop_back;
+template <typename T> constexpr bool container_traits<T>::has_pop_front;
+template <typename T> constexpr bool container_traits<T>::has_emplace_back;
+template <typename T> constexpr bool container_traits<T>::has_emplace_front;
+template <typename T> constexpr bool container_traits<T>::has_reserve;
+template <typename T> constexpr bool container_traits<T>::has_capacity;
+template <typename T> constexpr bool container_traits<T>::has_rehash;
+template <typename T> constexpr bool container_traits<T>::has_bucket_count;
+template <typename T> constexpr bool container_traits<T>::has_shrink_to_fit;
+template <typename T> constexpr bool container_traits<T>::has_subscript;
+template <typename T> constexpr bool container_traits<T>::is_contiguous;
+
+#endif
+
+#ifdef PYCPP_CPP14
+
+// SFINAE
+// ------
+
+template <typename T>
+constexpr bool has_data_v = has_data<T>::value;
+
+template <typename T>
+constexpr uint32_t container_capabilities_v = container_traits<T>::capabilities;
+
+#endif
+
+PYCPP_END_NAMESPACE
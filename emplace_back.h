@@ -8,13 +8,19 @@
  *
  *  \synopsis
  *      template <typename T>
- *      struct has_emplace_back: implementation_defined
+ *      using has_emplace_back = bool_constant<container_traits<T>::has_emplace_back>;
+ *
+ *      template <typename T, typename... Ts>
+ *      struct is_nothrow_emplace_back: implementation_defined
  *      {};
  *
  *      struct emplace_back
  *      {
  *          template <typename T, typename... Ts>
- *          void operator()(T& t, Ts&&... ts);
+ *          constexpr void operator()(T& t, Ts&&... ts) noexcept(is_nothrow_emplace_back<T, Ts...>::value);
+ *
+ *          template <typename T, typename... Ts>
+ *          constexpr void operator()(allow_fallback_t, T& t, Ts&&... ts) noexcept(is_nothrow_emplace_back<T, Ts...>::value);
  *      };
  *
  *      #if PYCPP_CPP14
@@ -22,55 +28,127 @@
  *      template <typename T>
  *      constexpr bool has_emplace_back_v = implementation-defined;
  *
+ *      template <typename T, typename... Ts>
+ *      constexpr bool is_nothrow_emplace_back_v = implementation-defined;
+ *
  *      #endif
  */
 
 #pragma once
 
 #include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/container_traits.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/profile.h>
 #include <pycpp/stl/type_traits.h>
 #include <pycpp/stl/utility.h>
 
 PYCPP_BEGIN_NAMESPACE
 
+namespace emplace_back_detail
+{
 // SFINAE
 // ------
 
-// C++17 changed the return type from `void` to `reference`.
-#if defined(PYCPP_CPP17)
-#   define PYCPP_EMPLACE_BACK typename C::reference (C::*)(typename C::value_type&&)
-#else
-#   define PYCPP_EMPLACE_BACK void (C::*)(typename C::value_type&&)
-#endif
+template <bool Native, typename T, typename... Ts>
+struct is_nothrow: bool_constant<noexcept(declval<T&>().emplace_back(declval<Ts>()...))>
+{};
 
-PYCPP_HAS_MEMBER_FUNCTION(emplace_back, has_emplace_back, PYCPP_EMPLACE_BACK);
-#undef PYCPP_EMPLACE_BACK
+template <typename T, typename... Ts>
+struct is_nothrow<false, T, Ts...>: bool_constant<noexcept(declval<T&>().insert(declval<T&>().end(), declval<Ts>()...))>
+{};
 
+}   /* emplace_back_detail */
+
+// SFINAE
+// ------
+
+/**
+ *  Detect a native `emplace_back`, from `container_traits`.
+ */
+template <typename T>
+using has_emplace_back = bool_constant<container_traits<T>::has_emplace_back>;
+
+/**
+ *  Detect if the call selected by `emplace_back` cannot throw.
+ */
+template <typename T, typename... Ts>
+using is_nothrow_emplace_back = emplace_back_detail::is_nothrow<container_traits<T>::has_emplace_back, T, Ts...>;
 
 /**
  *  \brief Call `emplace_back` as a functor.
  */
 struct emplace_back
 {
-    template <typename T, typename... Ts>
-    enable_if_t<has_emplace_back<T>::value, void>
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T, typename... Ts>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t,
+        Ts&&... ts
+    )
+    noexcept(is_nothrow_emplace_back<T, Ts...>::value)
+    {
+        if constexpr (container_traits<T>::has_emplace_back) {
+            PYCPP_SFINAE_PROFILE_SCOPE(emplace_back, T, true);
+            t.emplace_back(forward<Ts>(ts)...);
+        } else {
+            PYCPP_SFINAE_REQUIRE_COMPLEXITY(emplace_back, T, AllowFallback);
+            PYCPP_SFINAE_PROFILE_SCOPE(emplace_back, T, false);
+            t.insert(t.end(), forward<Ts>(ts)...);
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T, typename... Ts>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_emplace_back, void>
     operator()(
         T &t,
         Ts&&... ts
     )
+    noexcept(is_nothrow_emplace_back<T, Ts...>::value)
     {
+        PYCPP_SFINAE_PROFILE_SCOPE(emplace_back, T, true);
         t.emplace_back(forward<Ts>(ts)...);
     }
 
-    template <typename T, typename... Ts>
-    enable_if_t<!has_emplace_back<T>::value, void>
+    template <bool AllowFallback = false, typename T, typename... Ts>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_emplace_back, void>
     operator()(
         T &t,
         Ts&&... ts
     )
+    noexcept(is_nothrow_emplace_back<T, Ts...>::value)
     {
+        PYCPP_SFINAE_REQUIRE_COMPLEXITY(emplace_back, T, AllowFallback);
+        PYCPP_SFINAE_PROFILE_SCOPE(emplace_back, T, false);
         t.insert(t.end(), forward<Ts>(ts)...);
     }
+
+#endif
+
+    template <typename T, typename... Ts>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        allow_fallback_t,
+        T &t,
+        Ts&&... ts
+    )
+    noexcept(is_nothrow_emplace_back<T, Ts...>::value)
+    {
+        this->template operator()<true>(t, forward<Ts>(ts)...);
+    }
 };
 
 #ifdef PYCPP_CPP14
@@ -79,8 +157,17 @@ struct emplace_back
 // ------
 
 template <typename T>
-constexpr bool has_emplace_back_v = has_emplace_back<T>::value;
+constexpr bool has_emplace_back_v = container_traits<T>::has_emplace_back;
+
+template <typename T, typename... Ts>
+constexpr bool is_nothrow_emplace_back_v = is_nothrow_emplace_back<T, Ts...>::value;
 
 #endif
 
 PYCPP_END_NAMESPACE
+
+// Strict mode checks the cost of the fallback, from `complexity.h`,
+// unless a batch functor includes it once the batch functor is defined.
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY) && !defined(PYCPP_SFINAE_DETAIL_DEFER_COMPLEXITY)
+#   include <pycpp/sfinae/complexity.h>
+#endif
@@ -0,0 +1,495 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief SFINAE detection for range insertion and fail-safe implementation.
+ *
+ *  Append a range of items to the end of the container, reserving
+ *  storage once if the size of the range is known in advance. Passing
+ *  `allow_fallback_t` forwards the opt-in to `push_back` when items
+ *  are pushed one at a time, in strict mode.
+ *
+ *  \synopsis
+ *      template <typename T, typename It>
+ *      struct has_append: implementation_defined
+ *      {};
+ *
+ *      template <typename T, typename It>
+ *      struct has_range_insert: implementation_defined
+ *      {};
+ *
+ *      template <typename T, typename It>
+ *      struct has_unpositioned_range_insert: implementation_defined
+ *      {};
+ *
+ *      template <typename T, typename It>
+ *      struct is_nothrow_extend: implementation_defined
+ *      {};
+ *
+ *      struct extend
+ *      {
+ *          template <typename T, typename It>
+ *          constexpr void operator()(T& t, It first, It last) noexcept(is_nothrow_extend<T, It>::value);
+ *
+ *          template <typename T, typename It>
+ *          constexpr void operator()(allow_fallback_t, T& t, It first, It last) noexcept(is_nothrow_extend<T, It>::value);
+ *
+ *          template <typename T, typename Range>
+ *          constexpr void operator()(T& t, const Range& range) noexcept(implementation-defined);
+ *
+ *          template <typename T, typename Range>
+ *          constexpr void operator()(allow_fallback_t, T& t, const Range& range) noexcept(implementation-defined);
+ *      };
+ *
+ *      #if PYCPP_CPP20
+ *
+ *      template <typename T, typename It>
+ *      concept supports_append = implementation-defined;
+ *
+ *      template <typename T, typename It>
+ *      concept supports_range_insert = implementation-defined;
+ *
+ *      template <typename T, typename It>
+ *      concept supports_unpositioned_range_insert = implementation-defined;
+ *
+ *      #endif
+ *
+ *      #if PYCPP_CPP14
+ *
+ *      template <typename T, typename It>
+ *      constexpr bool has_append_v = implementation-defined;
+ *
+ *      template <typename T, typename It>
+ *      constexpr bool has_range_insert_v = implementation-defined;
+ *
+ *      template <typename T, typename It>
+ *      constexpr bool has_unpositioned_range_insert_v = implementation-defined;
+ *
+ *      template <typename T, typename It>
+ *      constexpr bool is_nothrow_extend_v = implementation-defined;
+ *
+ *      #endif
+ */
+
+#pragma once
+
+// `complexity.h` specializes `complexity` for the batch functors, so
+// it is only included once they are defined.
+#define PYCPP_SFINAE_DETAIL_DEFER_COMPLEXITY
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/profile.h>
+#include <pycpp/sfinae/push_back.h>
+#include <pycpp/sfinae/reserve.h>
+#include <pycpp/stl/iterator.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+// SFINAE
+// ------
+
+#if defined(PYCPP_CPP20)
+
+/**
+ *  Detect `t.append(first, last)`, as provided by `basic_string`.
+ */
+template <typename T, typename It>
+concept supports_append = requires(T& t, It it) {
+    t.append(it, it);
+};
+
+template <typename T, typename It>
+using has_append = bool_constant<supports_append<T, It>>;
+
+/**
+ *  Detect `t.insert(pos, first, last)`, as provided by sequence containers.
+ */
+template <typename T, typename It>
+concept supports_range_insert = requires(T& t, It it) {
+    t.insert(t.end(), it, it);
+};
+
+template <typename T, typename It>
+using has_range_insert = bool_constant<supports_range_insert<T, It>>;
+
+/**
+ *  Detect `t.insert(first, last)`, as provided by associative containers.
+ */
+template <typename T, typename It>
+concept supports_unpositioned_range_insert = requires(T& t, It it) {
+    t.insert(it, it);
+};
+
+template <typename T, typename It>
+using has_unpositioned_range_insert = bool_constant<supports_unpositioned_range_insert<T, It>>;
+
+#else
+
+/**
+ *  Detect `t.append(first, last)`, as provided by `basic_string`.
+ */
+template <typename T, typename It, typename = void>
+struct has_append_impl: false_type
+{};
+
+template <typename T, typename It>
+struct has_append_impl<T, It, void_t<decltype(declval<T&>().append(declval<It>(), declval<It>()))>>: true_type
+{};
+
+template <typename T, typename It>
+using has_append = has_append_impl<T, It>;
+
+/**
+ *  Detect `t.insert(pos, first, last)`, as provided by sequence containers.
+ */
+template <typename T, typename It, typename = void>
+struct has_range_insert_impl: false_type
+{};
+
+template <typename T, typename It>
+struct has_range_insert_impl<T, It, void_t<decltype(declval<T&>().insert(declval<T&>().end(), declval<It>(), declval<It>()))>>: true_type
+{};
+
+template <typename T, typename It>
+using has_range_insert = has_range_insert_impl<T, It>;
+
+/**
+ *  Detect `t.insert(first, last)`, as provided by associative containers.
+ */
+template <typename T, typename It, typename = void>
+struct has_unpositioned_range_insert_impl: false_type
+{};
+
+template <typename T, typename It>
+struct has_unpositioned_range_insert_impl<T, It, void_t<decltype(declval<T&>().insert(declval<It>(), declval<It>()))>>: true_type
+{};
+
+template <typename T, typename It>
+using has_unpositioned_range_insert = has_unpositioned_range_insert_impl<T, It>;
+
+#endif
+
+namespace extend_detail
+{
+// SFINAE
+// ------
+
+template <typename It>
+using is_forward_iterator = is_base_of<forward_iterator_tag, typename iterator_traits<It>::iterator_category>;
+
+/**
+ *  Only compute the distance of the range if it can be done
+ *  without consuming the iterators, and if the container
+ *  can make use of it.
+ */
+template <typename T, typename It>
+using is_reservable = bool_constant<reserve_detail::is_reservable<T>::value && is_forward_iterator<It>::value>;
+
+template <typename T, typename It>
+using use_append = has_append<T, It>;
+
+template <typename T, typename It>
+using use_range_insert = bool_constant<!use_append<T, It>::value && has_range_insert<T, It>::value>;
+
+template <typename T, typename It>
+using use_unpositioned_range_insert = bool_constant<
+    !use_append<T, It>::value &&
+    !use_range_insert<T, It>::value &&
+    has_unpositioned_range_insert<T, It>::value
+>;
+
+template <typename T, typename It>
+using use_push_back = bool_constant<
+    !use_append<T, It>::value &&
+    !use_range_insert<T, It>::value &&
+    !use_unpositioned_range_insert<T, It>::value
+>;
+
+template <typename T, typename It, typename = void>
+struct is_nothrow_reserve_range: true_type
+{};
+
+template <typename T, typename It>
+struct is_nothrow_reserve_range<T, It, enable_if_t<is_reservable<T, It>::value>>: bool_constant<
+        noexcept(distance(declval<It&>(), declval<It&>())) &&
+        noexcept(reserve()(declval<T&>(), declval<size_t>(), additional_reserve_t()))
+    >
+{};
+
+template <typename T, typename It, typename = void>
+struct is_nothrow_insert: bool_constant<
+        noexcept(declval<It&>() != declval<It&>()) &&
+        noexcept(++declval<It&>()) &&
+        noexcept(push_back()(declval<T&>(), *declval<It&>()))
+    >
+{};
+
+template <typename T, typename It>
+struct is_nothrow_insert<T, It, enable_if_t<use_append<T, It>::value>>: bool_constant<noexcept(declval<T&>().append(declval<It>(), declval<It>()))>
+{};
+
+template <typename T, typename It>
+struct is_nothrow_insert<T, It, enable_if_t<use_range_insert<T, It>::value>>: bool_constant<noexcept(declval<T&>().insert(declval<T&>().end(), declval<It>(), declval<It>()))>
+{};
+
+template <typename T, typename It>
+struct is_nothrow_insert<T, It, enable_if_t<use_unpositioned_range_insert<T, It>::value>>: bool_constant<noexcept(declval<T&>().insert(declval<It>(), declval<It>()))>
+{};
+
+template <typename T, typename It>
+using is_nothrow = bool_constant<is_nothrow_reserve_range<T, It>::value && is_nothrow_insert<T, It>::value>;
+
+template <typename T, typename Range>
+using is_nothrow_range = bool_constant<
+    is_nothrow<T, decltype(begin(declval<const Range&>()))>::value &&
+    noexcept(begin(declval<const Range&>())) &&
+    noexcept(end(declval<const Range&>()))
+>;
+
+// FUNCTIONS
+// ---------
+
+#if defined(PYCPP_CPP20)
+
+template <typename T, typename It>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+void
+reserve_range(
+    T &t,
+    It first,
+    It last
+)
+noexcept(is_nothrow_reserve_range<T, It>::value)
+{
+    if constexpr (is_reservable<T, It>::value) {
+        reserve()(t, static_cast<size_t>(distance(first, last)), additional_reserve_t());
+    }
+}
+
+#else
+
+template <typename T, typename It>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<is_reservable<T, It>::value, void>
+reserve_range(
+    T &t,
+    It first,
+    It last
+)
+noexcept(is_nothrow_reserve_range<T, It>::value)
+{
+    reserve()(t, static_cast<size_t>(distance(first, last)), additional_reserve_t());
+}
+
+template <typename T, typename It>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<!is_reservable<T, It>::value, void>
+reserve_range(
+    T &t,
+    It first,
+    It last
+)
+noexcept(is_nothrow_reserve_range<T, It>::value)
+{}
+
+#endif
+
+}   /* extend_detail */
+
+// SFINAE
+// ------
+
+/**
+ *  Detect if the calls selected by `extend` cannot throw.
+ */
+template <typename T, typename It>
+using is_nothrow_extend = extend_detail::is_nothrow<T, It>;
+
+/**
+ *  \brief Append a range of items to a container as a functor.
+ *
+ *  Prefer `append`, then positional range `insert` at the end, then
+ *  unpositioned range `insert`, and only push items individually if
+ *  the container lacks all three.
+ */
+struct extend
+{
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T, typename It>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t,
+        It first,
+        It last
+    )
+    noexcept(is_nothrow_extend<T, It>::value)
+    {
+        if constexpr (extend_detail::use_append<T, It>::value) {
+            PYCPP_SFINAE_PROFILE_SCOPE(extend, T, true);
+            extend_detail::reserve_range(t, first, last);
+            t.append(first, last);
+        } else if constexpr (extend_detail::use_range_insert<T, It>::value) {
+            PYCPP_SFINAE_PROFILE_SCOPE(extend, T, true);
+            extend_detail::reserve_range(t, first, last);
+            t.insert(t.end(), first, last);
+        } else if constexpr (extend_detail::use_unpositioned_range_insert<T, It>::value) {
+            PYCPP_SFINAE_PROFILE_SCOPE(extend, T, true);
+            extend_detail::reserve_range(t, first, last);
+            t.insert(first, last);
+        } else {
+            PYCPP_SFINAE_PROFILE_SCOPE(extend, T, false);
+            extend_detail::reserve_range(t, first, last);
+            for (; first != last; ++first) {
+                push_back().template operator()<AllowFallback>(t, *first);
+            }
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T, typename It>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<extend_detail::use_append<T, It>::value, void>
+    operator()(
+        T &t,
+        It first,
+        It last
+    )
+    noexcept(is_nothrow_extend<T, It>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(extend, T, true);
+        extend_detail::reserve_range(t, first, last);
+        t.append(first, last);
+    }
+
+    template <bool AllowFallback = false, typename T, typename It>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<extend_detail::use_range_insert<T, It>::value, void>
+    operator()(
+        T &t,
+        It first,
+        It last
+    )
+    noexcept(is_nothrow_extend<T, It>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(extend, T, true);
+        extend_detail::reserve_range(t, first, last);
+        t.insert(t.end(), first, last);
+    }
+
+    template <bool AllowFallback = false, typename T, typename It>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<extend_detail::use_unpositioned_range_insert<T, It>::value, void>
+    operator()(
+        T &t,
+        It first,
+        It last
+    )
+    noexcept(is_nothrow_extend<T, It>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(extend, T, true);
+        extend_detail::reserve_range(t, first, last);
+        t.insert(first, last);
+    }
+
+    template <bool AllowFallback = false, typename T, typename It>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<extend_detail::use_push_back<T, It>::value, void>
+    operator()(
+        T &t,
+        It first,
+        It last
+    )
+    noexcept(is_nothrow_extend<T, It>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(extend, T, false);
+        extend_detail::reserve_range(t, first, last);
+        for (; first != last; ++first) {
+            push_back().template operator()<AllowFallback>(t, *first);
+        }
+    }
+
+#endif
+
+    template <typename T, typename It>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        allow_fallback_t,
+        T &t,
+        It first,
+        It last
+    )
+    noexcept(is_nothrow_extend<T, It>::value)
+    {
+        this->template operator()<true>(t, first, last);
+    }
+
+    template <typename T, typename Range>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t,
+        const Range& range
+    )
+    noexcept(extend_detail::is_nothrow_range<T, Range>::value)
+    {
+        (*this)(t, begin(range), end(range));
+    }
+
+    template <typename T, typename Range>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        allow_fallback_t,
+        T &t,
+        const Range& range
+    )
+    noexcept(extend_detail::is_nothrow_range<T, Range>::value)
+    {
+        this->template operator()<true>(t, begin(range), end(range));
+    }
+};
+
+#ifdef PYCPP_CPP14
+
+// SFINAE
+// ------
+
+template <typename T, typename It>
+constexpr bool has_append_v = has_append<T, It>::value;
+
+template <typename T, typename It>
+constexpr bool has_range_insert_v = has_range_insert<T, It>::value;
+
+template <typename T, typename It>
+constexpr bool has_unpositioned_range_insert_v = has_unpositioned_range_insert<T, It>::value;
+
+template <typename T, typename It>
+constexpr bool is_nothrow_extend_v = is_nothrow_extend<T, It>::value;
+
+#endif
+
+PYCPP_END_NAMESPACE
+
+// Strict mode checks the cost of the fallback, from `complexity.h`.
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY)
+#   include <pycpp/sfinae/complexity.h>
+#endif
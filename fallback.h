@@ -0,0 +1,117 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Opt-in to fallbacks slower than constant time.
+ *
+ *  The minimal declarations used by the functors with a fallback.
+ *  The cost of each functor, `complexity<Functor, T>`, is defined in
+ *  `complexity.h`, which the functor headers only include if
+ *  `PYCPP_SFINAE_STRICT_COMPLEXITY` is defined.
+ *
+ *  If `PYCPP_SFINAE_STRICT_COMPLEXITY` is defined, calling a functor
+ *  whose selected path is slower than constant time fails to
+ *  compile, unless `allow_fallback_t` is passed as the first argument.
+ *  Otherwise, `PYCPP_SFINAE_REQUIRE_COMPLEXITY` expands to nothing,
+ *  and `allow_fallback_t` is accepted and ignored.
+ *
+ *  \synopsis
+ *      #define PYCPP_SFINAE_REQUIRE_COMPLEXITY(functor, T, allow) implementation-defined
+ *
+ *      enum class complexity_class
+ *      {
+ *          constant,
+ *          logarithmic,
+ *          linear,
+ *      };
+ *
+ *      struct allow_fallback_t {};
+ *
+ *      template <typename Functor, typename T>
+ *      struct complexity;
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+// OBJECTS
+// -------
+
+/**
+ *  \brief Asymptotic cost, as a function of the container size.
+ */
+enum class complexity_class
+{
+    constant,
+    logarithmic,
+    linear,
+};
+
+// POLICIES
+// --------
+
+/**
+ *  \brief Opt in to a fallback slower than constant time, when
+ *  `PYCPP_SFINAE_STRICT_COMPLEXITY` is defined.
+ */
+struct allow_fallback_t
+{};
+
+// SFINAE
+// ------
+
+/**
+ *  \brief Cost of the path selected by `Functor` for `T`.
+ *
+ *  Specialized in `complexity.h` for each functor with a fallback.
+ */
+template <typename Functor, typename T>
+struct complexity;
+
+namespace fallback_detail
+{
+// SFINAE
+// ------
+
+template <typename T>
+using dereference_iterator_type = decltype(*declval<typename T::iterator>());
+
+template <typename T>
+using is_const_iterator = is_same<dereference_iterator_type<T>, typename T::const_reference>;
+
+/**
+ *  Containers with only constant iterators, like `set`, return
+ *  constant references from `back` and `front`.
+ */
+template <typename T>
+struct is_const: bool_constant<PYCPP_NAMESPACE::is_const<T>::value || is_const_iterator<T>::value>
+{};
+
+template <typename T>
+using reference_t = conditional_t<is_const<T>::value, typename T::const_reference, typename T::reference>;
+
+}   /* fallback_detail */
+
+PYCPP_END_NAMESPACE
+
+// MACROS
+// ------
+
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY)
+
+#define PYCPP_SFINAE_REQUIRE_COMPLEXITY(functor, T, allow)                     \
+    static_assert(                                                              \
+        allow || PYCPP_NAMESPACE::complexity<functor, PYCPP_NAMESPACE::remove_const_t<T>>::value == PYCPP_NAMESPACE::complexity_class::constant, \
+        "`" #functor "` falls back to a call slower than constant time, pass `allow_fallback_t()` as the first argument to allow it."   \
+    )
+
+#else
+
+#define PYCPP_SFINAE_REQUIRE_COMPLEXITY(functor, T, allow)
+
+#endif
@@ -8,16 +8,22 @@
  *
  *  \synopsis
  *      template <typename T>
- *      struct has_front: implementation_defined
+ *      using has_front = bool_constant<container_traits<T>::has_front>;
+ *
+ *      template <typename T>
+ *      struct is_nothrow_front: implementation_defined
  *      {};
  *
  *      struct front
  *      {
  *          template <typename T>
- *          typename T::reference operator()(T& t);
+ *          constexpr typename T::reference operator()(T& t) noexcept(is_nothrow_front<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr typename T::const_reference operator()(const T& t) noexcept(is_nothrow_front<const T>::value);
  *
  *          template <typename T>
- *          typename T::const_reference operator()(const T& t);
+ *          constexpr fallback_detail::reference_t<T> operator()(allow_fallback_t, T& t) noexcept(is_nothrow_front<T>::value);
  *      };
  *
  *      #if PYCPP_CPP14
@@ -25,63 +31,173 @@
  *      template <typename T>
  *      constexpr bool has_front_v = implementation-defined;
  *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_front_v = implementation-defined;
+ *
  *      #endif
  */
 
 #pragma once
 
-#include <pycpp/sfinae/back.h>
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/container_traits.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/profile.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
 
 PYCPP_BEGIN_NAMESPACE
 
+namespace front_detail
+{
+// SFINAE
+// ------
+
+template <bool Native, typename T>
+struct is_nothrow: bool_constant<noexcept(declval<T&>().front())>
+{};
+
+template <typename T>
+struct is_nothrow<false, T>: bool_constant<noexcept(*declval<T&>().begin())>
+{};
+
+}   /* front_detail */
+
 // SFINAE
 // ------
 
-PYCPP_HAS_MEMBER_FUNCTION(front, has_front, typename C::reference (C::*)());
+/**
+ *  Detect a native `front`, from `container_traits`.
+ */
+template <typename T>
+using has_front = bool_constant<container_traits<T>::has_front>;
 
+/**
+ *  Detect if the call selected by `front` cannot throw.
+ */
+template <typename T>
+using is_nothrow_front = front_detail::is_nothrow<container_traits<remove_const_t<T>>::has_front, T>;
 
 /**
  *  \brief Call `front` as a functor.
  */
 struct front
 {
-    template <typename T>
-    enable_if_t<has_front<T>::value && !back_detail::is_const<T>::value, typename T::reference>
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T>
+    requires (!fallback_detail::is_const<T>::value)
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    typename T::reference
+    operator()(
+        T &t
+    )
+    noexcept(is_nothrow_front<T>::value)
+    {
+        if constexpr (container_traits<T>::has_front) {
+            PYCPP_SFINAE_PROFILE_SCOPE(front, T, true);
+            return t.front();
+        } else {
+            PYCPP_SFINAE_REQUIRE_COMPLEXITY(front, T, AllowFallback);
+            PYCPP_SFINAE_PROFILE_SCOPE(front, T, false);
+            return *t.begin();
+        }
+    }
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    typename T::const_reference
+    operator()(
+        const T &t
+    )
+    const
+    noexcept(is_nothrow_front<const T>::value)
+    {
+        if constexpr (container_traits<T>::has_front) {
+            PYCPP_SFINAE_PROFILE_SCOPE(front, T, true);
+            return t.front();
+        } else {
+            PYCPP_SFINAE_REQUIRE_COMPLEXITY(front, T, AllowFallback);
+            PYCPP_SFINAE_PROFILE_SCOPE(front, T, false);
+            return *t.begin();
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_front && !fallback_detail::is_const<T>::value, typename T::reference>
     operator()(
         T &t
     )
+    noexcept(is_nothrow_front<T>::value)
     {
+        PYCPP_SFINAE_PROFILE_SCOPE(front, T, true);
         return t.front();
     }
 
-    template <typename T>
-    enable_if_t<!has_front<T>::value && !back_detail::is_const<T>::value, typename T::reference>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_front && !fallback_detail::is_const<T>::value, typename T::reference>
     operator()(
         T &t
     )
+    noexcept(is_nothrow_front<T>::value)
     {
+        PYCPP_SFINAE_REQUIRE_COMPLEXITY(front, T, AllowFallback);
+        PYCPP_SFINAE_PROFILE_SCOPE(front, T, false);
         return *t.begin();
     }
 
-    template <typename T>
-    enable_if_t<has_front<T>::value, typename T::const_reference>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_front, typename T::const_reference>
     operator()(
         const T &t
     )
     const
+    noexcept(is_nothrow_front<const T>::value)
     {
+        PYCPP_SFINAE_PROFILE_SCOPE(front, T, true);
         return t.front();
     }
 
-    template <typename T>
-    enable_if_t<!has_front<T>::value, typename T::const_reference>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_front, typename T::const_reference>
     operator()(
         const T &t
     )
     const
+    noexcept(is_nothrow_front<const T>::value)
     {
+        PYCPP_SFINAE_REQUIRE_COMPLEXITY(front, T, AllowFallback);
+        PYCPP_SFINAE_PROFILE_SCOPE(front, T, false);
         return *t.begin();
     }
+
+#endif
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    fallback_detail::reference_t<T>
+    operator()(
+        allow_fallback_t,
+        T &t
+    )
+    noexcept(is_nothrow_front<T>::value)
+    {
+        return this->template operator()<true>(t);
+    }
 };
 
 #ifdef PYCPP_CPP14
@@ -90,8 +206,17 @@ struct front
 // ------
 
 template <typename T>
-constexpr bool has_front_v = has_front<T>::value;
+constexpr bool has_front_v = container_traits<T>::has_front;
+
+template <typename T>
+constexpr bool is_nothrow_front_v = is_nothrow_front<T>::value;
 
 #endif
 
 PYCPP_END_NAMESPACE
+
+// Strict mode checks the cost of the fallback, from `complexity.h`,
+// unless a batch functor includes it once the batch functor is defined.
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY) && !defined(PYCPP_SFINAE_DETAIL_DEFER_COMPLEXITY)
+#   include <pycpp/sfinae/complexity.h>
+#endif
@@ -0,0 +1,31 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Fail-safe container functors.
+ *
+ *  SFINAE detection for container methods and fail-safe
+ *  implementations as functors.
+ */
+
+#pragma once
+
+#include <pycpp/sfinae/accumulate.h>
+#include <pycpp/sfinae/back.h>
+#include <pycpp/sfinae/complex_kernels.h>
+#include <pycpp/sfinae/complexity.h>
+#include <pycpp/sfinae/concat.h>
+#include <pycpp/sfinae/elementwise.h>
+#include <pycpp/sfinae/emplace_back.h>
+#include <pycpp/sfinae/emplace_front.h>
+#include <pycpp/sfinae/extend.h>
+#include <pycpp/sfinae/front.h>
+#include <pycpp/sfinae/pop_back.h>
+#include <pycpp/sfinae/pop_front.h>
+#include <pycpp/sfinae/pop_n.h>
+#include <pycpp/sfinae/profile.h>
+#include <pycpp/sfinae/push_back.h>
+#include <pycpp/sfinae/push_front.h>
+#include <pycpp/sfinae/reserve.h>
+#include <pycpp/sfinae/resize_uninitialized.h>
+#include <pycpp/sfinae/shrink_to_fit.h>
@@ -5,7 +5,8 @@
  *  \brief Check if types support a specific operator.
  *
  *  Macro to detect if two types support a desired operation, expanding
- *  to a struct similar to `bool_constant`.
+ *  to a struct similar to `bool_constant`. In C++20, the macro also
+ *  defines a `supports_##name` concept, from which the trait derives.
  *
  *  \synopsis
  *      #define PYCPP_HAS_OPERATION(name, op)   implementation-defined
@@ -13,6 +14,7 @@
 
 #pragma once
 
+#include <pycpp/preprocessor/compiler.h>
 #include <pycpp/stl/type_traits.h>
 #include <pycpp/stl/utility.h>
 
@@ -33,28 +35,47 @@ add_lvalue_reference_t<T> decl_lvalue() noexcept;
 // MACROS
 // ------
 
+#if defined(PYCPP_CPP20)
+
 /**
  *  \brief Macro to check if operation is supported between types.
+ *
+ *  Uses a `requires` expression, which is cheaper to evaluate than
+ *  partial specialization and reports the failed expression in
+ *  diagnostics.
  */
 #define PYCPP_HAS_OPERATION(name, op)                                           \
     template <typename T, typename U = T>                                       \
-    struct has_##name                                                           \
-    {                                                                           \
-    protected:                                                                  \
-        template <typename T1 = T, typename U1 = U>                             \
-        static                                                                  \
-        char&                                                                   \
-        test(decltype(decl_lvalue<T1>() op declval<U1>()));                     \
+    concept supports_##name = requires {                                        \
+        decl_lvalue<T>() op declval<U>();                                       \
+    };                                                                          \
                                                                                 \
-        template <typename T1 = T, typename U1 = U>                             \
-        static                                                                  \
-        long&                                                                   \
-        test(...);                                                              \
+    template <typename T, typename U = T>                                       \
+    using has_##name = bool_constant<supports_##name<T, U>>
+
+#else
+
+/**
+ *  \brief Macro to check if operation is supported between types.
+ *
+ *  Uses partial specialization on `void_t` rather than overload
+ *  resolution, which avoids instantiating and ranking a pair of
+ *  `test` overloads for every pair of types.
+ */
+#define PYCPP_HAS_OPERATION(name, op)                                           \
+    template <typename T, typename U, typename = void>                          \
+    struct has_##name##_impl: false_type                                        \
+    {};                                                                         \
                                                                                 \
-    public:                                                                     \
-        enum {                                                                  \
-            value = sizeof(test<T, U>(decl_lvalue<int>())) == sizeof(char)      \
-        };                                                                      \
-    }
+    template <typename T, typename U>                                           \
+    struct has_##name##_impl<                                                   \
+        T, U, void_t<decltype(decl_lvalue<T>() op declval<U>())>                \
+    >: true_type                                                                \
+    {};                                                                         \
+                                                                                \
+    template <typename T, typename U = T>                                       \
+    using has_##name = has_##name##_impl<T, U>
+
+#endif
 
 PYCPP_END_NAMESPACE
@@ -5,11 +5,19 @@
  *  \brief Check if container supports `[]` with subscript.
  *
  *  Detect if the `C` supports subscripting with `I` (`C[I]`).
+ *  In C++20, the trait derives from the `supports_subscript` concept.
  *
  *  \synopsis
  *      template <typename C, typename I>
  *      using has_subscript = implementation-defined;
  *
+ *      #if PYCPP_CPP20
+ *
+ *      template <typename C, typename I>
+ *      concept supports_subscript = implementation-defined;
+ *
+ *      #endif
+ *
  *      #if PYCPP_CPP14
  *
  *      template <typename C, typename I>
@@ -20,6 +28,7 @@
 
 #pragma once
 
+#include <pycpp/preprocessor/compiler.h>
 #include <pycpp/stl/type_traits.h>
 #include <pycpp/stl/utility.h>
 
@@ -28,6 +37,18 @@ PYCPP_BEGIN_NAMESPACE
 // SFINAE
 // ------
 
+#if defined(PYCPP_CPP20)
+
+template <typename C, typename I>
+concept supports_subscript = requires {
+    declval<C>()[declval<I>()];
+};
+
+template <typename C, typename I>
+using has_subscript = bool_constant<supports_subscript<C, I>>;
+
+#else
+
 template <typename C, typename I, typename = void>
 struct has_subscript_impl: false_type
 {};
@@ -39,6 +60,8 @@ struct has_subscript_impl<C, I, void_t<decltype(declval<C>()[declval<I>()])>>: t
 template <typename C, typename I>
 using has_subscript = has_subscript_impl<C, I>;
 
+#endif
+
 #ifdef PYCPP_CPP14
 
 // SFINAE
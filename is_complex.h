@@ -19,6 +19,8 @@
  *      #endif
  */
 
+#pragma once
+
 #include <pycpp/sfinae/is_specialization.h>
 #include <pycpp/stl/complex.h>
 
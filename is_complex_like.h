@@ -0,0 +1,124 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Check if the type has the layout of a complex number.
+ *
+ *  Detect `std::complex`, or any type with `real()` and `imag()`
+ *  methods returning the same type `R`, which may be used item by item.
+ *
+ *  `is_interleaved_complex` opts a complex-like type in to being viewed
+ *  as interleaved real and imaginary parts, so a buffer of them may be
+ *  processed without conversion. It is true for `std::complex`, and
+ *  may be specialized as `true_type` for a standard-layout type storing
+ *  exactly the real part, then the imaginary part, as two `R`. The
+ *  accessors are not enough to detect the layout, since they may
+ *  calculate the parts (for example, from polar coordinates).
+ *
+ *  \synopsis
+ *      template <typename T>
+ *      struct is_complex_like: implementation-defined
+ *      {};
+ *
+ *      template <typename T>
+ *      struct is_interleaved_complex: implementation-defined
+ *      {};
+ *
+ *      template <typename T>
+ *      using complex_value_t = implementation-defined;
+ *
+ *      #if PYCPP_CPP14
+ *
+ *      template <typename T>
+ *      constexpr bool is_complex_like_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool is_interleaved_complex_v = implementation-defined;
+ *
+ *      #endif
+ */
+
+#pragma once
+
+#include <pycpp/sfinae/is_complex.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace complex_like_detail
+{
+// SFINAE
+// ------
+
+template <typename T, typename = void>
+struct parts
+{};
+
+template <typename T>
+struct parts<T, enable_if_t<is_same<
+        decay_t<decltype(declval<const T&>().real())>,
+        decay_t<decltype(declval<const T&>().imag())>
+    >::value>>
+{
+    using type = decay_t<decltype(declval<const T&>().real())>;
+};
+
+template <typename T, typename = void>
+struct has_parts: false_type
+{};
+
+template <typename T>
+struct has_parts<T, void_t<typename parts<T>::type>>: true_type
+{};
+
+template <typename T, typename = void>
+struct has_layout: false_type
+{};
+
+template <typename T>
+struct has_layout<T, void_t<typename parts<T>::type>>: bool_constant<
+        is_standard_layout<T>::value &&
+        sizeof(T) == 2 * sizeof(typename parts<T>::type)
+    >
+{};
+
+}   /* complex_like_detail */
+
+// SFINAE
+// ------
+
+template <typename T>
+struct is_complex_like: bool_constant<
+        is_complex<remove_cv_t<T>>::value ||
+        complex_like_detail::has_parts<remove_cv_t<T>>::value
+    >
+{};
+
+/**
+ *  Specialize as `true_type` if `T` stores the real, then imaginary part.
+ */
+template <typename T>
+struct is_interleaved_complex: is_complex<T>
+{};
+
+/**
+ *  Type of the real and imaginary parts of a complex-like type.
+ */
+template <typename T>
+using complex_value_t = typename complex_like_detail::parts<remove_cv_t<T>>::type;
+
+#ifdef PYCPP_CPP14
+
+// SFINAE
+// ------
+
+template <typename T>
+constexpr bool is_complex_like_v = is_complex_like<T>::value;
+
+template <typename T>
+constexpr bool is_interleaved_complex_v = is_interleaved_complex<T>::value;
+
+#endif
+
+PYCPP_END_NAMESPACE
@@ -0,0 +1,295 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Detection of contiguous containers and zero-copy views.
+ *
+ *  Detect if a container stores its items contiguously, that is,
+ *  a C-array or a type with a `data()` method returning a pointer
+ *  and a `size()` method. `as_span` returns a pointer and length
+ *  view over a contiguous container without copying, and fails to
+ *  compile for other containers unless a buffer is passed, in which
+ *  case the items are copied to the buffer.
+ *
+ *  \synopsis
+ *      template <typename T>
+ *      struct is_contiguous_container: implementation-defined
+ *      {};
+ *
+ *      template <typename T>
+ *      using contiguous_element_t = implementation-defined;
+ *
+ *      template <typename T>
+ *      struct contiguous_span
+ *      {
+ *          using element_type = T;
+ *          using value_type = remove_cv_t<T>;
+ *          using size_type = size_t;
+ *          using pointer = T*;
+ *          using reference = T&;
+ *          using iterator = T*;
+ *
+ *          constexpr contiguous_span() noexcept;
+ *          constexpr contiguous_span(pointer data, size_type size) noexcept;
+ *
+ *          template <typename U>
+ *          constexpr contiguous_span(const contiguous_span<U>& other) noexcept;
+ *
+ *          constexpr pointer data() const noexcept;
+ *          constexpr size_type size() const noexcept;
+ *          constexpr size_type size_bytes() const noexcept;
+ *          constexpr bool empty() const noexcept;
+ *          constexpr iterator begin() const noexcept;
+ *          constexpr iterator end() const noexcept;
+ *          constexpr reference operator[](size_type i) const noexcept;
+ *      };
+ *
+ *      struct as_span
+ *      {
+ *          template <typename T>
+ *          contiguous_span<contiguous_element_t<T>> operator()(T& t) const;
+ *
+ *          template <typename T, typename Buffer>
+ *          contiguous_span<const contiguous_element_t<Buffer>> operator()(T& t, Buffer& buffer) const;
+ *      };
+ *
+ *      #if PYCPP_CPP14
+ *
+ *      template <typename T>
+ *      constexpr bool is_contiguous_container_v = implementation-defined;
+ *
+ *      #endif
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/stl/iterator.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
+#include <stddef.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace contiguous_detail
+{
+// SFINAE
+// ------
+
+template <typename T, typename = void>
+struct has_data_size: false_type
+{};
+
+template <typename T>
+struct has_data_size<T, void_t<decltype(declval<T&>().data()), decltype(declval<T&>().size())>>:
+    is_pointer<decltype(declval<T&>().data())>
+{};
+
+template <typename T, typename = void>
+struct element
+{};
+
+template <typename T>
+struct element<T, enable_if_t<has_data_size<T>::value>>
+{
+    using type = remove_pointer_t<decltype(declval<T&>().data())>;
+};
+
+template <typename T, size_t N>
+struct element<T[N], void>
+{
+    using type = T;
+};
+
+}   /* contiguous_detail */
+
+// SFINAE
+// ------
+
+/**
+ *  Detect a C-array, or a type with `data()` returning a pointer
+ *  and `size()`.
+ */
+template <typename T>
+struct is_contiguous_container: bool_constant<
+        (is_array<T>::value && extent<T>::value != 0) ||
+        contiguous_detail::has_data_size<T>::value
+    >
+{};
+
+template <typename T>
+using contiguous_element_t = typename contiguous_detail::element<T>::type;
+
+// OBJECTS
+// -------
+
+/**
+ *  \brief Non-owning view over contiguous items.
+ */
+template <typename T>
+struct contiguous_span
+{
+    using element_type = T;
+    using value_type = remove_cv_t<T>;
+    using size_type = size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    constexpr contiguous_span() noexcept = default;
+
+    constexpr contiguous_span(pointer data, size_type size) noexcept:
+        data_(data),
+        size_(size)
+    {}
+
+    template <typename U, typename = enable_if_t<is_convertible<U(*)[], T(*)[]>::value>>
+    constexpr contiguous_span(const contiguous_span<U>& other) noexcept:
+        data_(other.data()),
+        size_(other.size())
+    {}
+
+    constexpr pointer data() const noexcept
+    {
+        return data_;
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    constexpr size_type size_bytes() const noexcept
+    {
+        return size_ * sizeof(T);
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    constexpr iterator begin() const noexcept
+    {
+        return data_;
+    }
+
+    constexpr iterator end() const noexcept
+    {
+        return data_ + size_;
+    }
+
+    constexpr reference operator[](size_type i) const noexcept
+    {
+        return data_[i];
+    }
+
+private:
+    pointer data_ = nullptr;
+    size_type size_ = 0;
+};
+
+namespace contiguous_detail
+{
+// FUNCTIONS
+// ---------
+
+template <typename T, size_t N>
+contiguous_span<T>
+view(
+    T (&t)[N]
+)
+{
+    return contiguous_span<T>(t, N);
+}
+
+template <typename T>
+contiguous_span<contiguous_element_t<T>>
+view(
+    T &t
+)
+{
+    return contiguous_span<contiguous_element_t<T>>(t.data(), static_cast<size_t>(t.size()));
+}
+
+}   /* contiguous_detail */
+
+
+/**
+ *  \brief View the items of a contiguous container as a functor.
+ *
+ *  Without a buffer, the container must be contiguous. With a
+ *  buffer, items from non-contiguous containers are copied to the
+ *  buffer (via `assign`), and the view refers to the buffer.
+ */
+struct as_span
+{
+    template <typename T>
+    contiguous_span<contiguous_element_t<T>>
+    operator()(
+        T &t
+    )
+    const
+    {
+        return contiguous_detail::view(t);
+    }
+
+#if defined(PYCPP_CPP20)
+
+    template <typename T, typename Buffer>
+    contiguous_span<const contiguous_element_t<Buffer>>
+    operator()(
+        T &t,
+        Buffer &buffer
+    )
+    const
+    {
+        if constexpr (is_contiguous_container<T>::value) {
+            static_assert(is_same<remove_cv_t<contiguous_element_t<T>>, remove_cv_t<contiguous_element_t<Buffer>>>::value, "Container and buffer must have the same items.");
+            return contiguous_detail::view(t);
+        } else {
+            buffer.assign(begin(t), end(t));
+            return contiguous_detail::view(buffer);
+        }
+    }
+
+#else
+
+    template <typename T, typename Buffer>
+    enable_if_t<is_contiguous_container<T>::value, contiguous_span<const contiguous_element_t<Buffer>>>
+    operator()(
+        T &t,
+        Buffer &
+    )
+    const
+    {
+        static_assert(is_same<remove_cv_t<contiguous_element_t<T>>, remove_cv_t<contiguous_element_t<Buffer>>>::value, "Container and buffer must have the same items.");
+        return contiguous_detail::view(t);
+    }
+
+    template <typename T, typename Buffer>
+    enable_if_t<!is_contiguous_container<T>::value, contiguous_span<const contiguous_element_t<Buffer>>>
+    operator()(
+        T &t,
+        Buffer &buffer
+    )
+    const
+    {
+        buffer.assign(begin(t), end(t));
+        return contiguous_detail::view(buffer);
+    }
+
+#endif
+};
+
+#ifdef PYCPP_CPP14
+
+// SFINAE
+// ------
+
+template <typename T>
+constexpr bool is_contiguous_container_v = is_contiguous_container<T>::value;
+
+#endif
+
+PYCPP_END_NAMESPACE
@@ -21,9 +21,7 @@
 
 #pragma once
 
-#include <pycpp/preprocessor/os.h>
 #include <pycpp/stl/type_traits.h>
-#include <pycpp/stl/utility.h>
 
 PYCPP_BEGIN_NAMESPACE
 
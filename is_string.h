@@ -6,6 +6,16 @@
  *
  *  Detect if type is one of many string types.
  *
+ *  `is_string` decays arrays to pointers, so the array length is lost.
+ *  `is_char_array` and `string_extent` preserve the length, which
+ *  bounds the scan for the null character by `string_size`, so
+ *  character arrays, constant or mutable, are treated as buffers
+ *  holding a string up to the first null character.
+ *
+ *  Passing `string_literal_t` asserts the array is a string literal,
+ *  whose only null character is the terminator, and finds the length
+ *  from the array extent without a scan.
+ *
  *  \synopsis
  *      template <typename T>
  *      using is_charp = implementation-defined;
@@ -37,6 +47,23 @@
  *      template <typename T>
  *      using is_string = implementation-defined;
  *
+ *      template <typename T>
+ *      using is_char_array = implementation-defined;
+ *
+ *      template <typename T>
+ *      using string_extent = implementation-defined;
+ *
+ *      struct string_literal_t {};
+ *
+ *      struct string_size
+ *      {
+ *          template <typename T>
+ *          size_t operator()(const T& t) const noexcept;
+ *
+ *          template <typename C, size_t N>
+ *          constexpr size_t operator()(const C (&s)[N], string_literal_t) const noexcept;
+ *      };
+ *
  *      #if PYCPP_CPP14
  *
  *      template <typename T>
@@ -69,6 +96,12 @@
  *      template <typename T>
  *      constexpr bool is_string_v = implementation-defined;
  *
+ *      template <typename T>
+ *      constexpr bool is_char_array_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr size_t string_extent_v = implementation-defined;
+ *
  *      #endif
  */
 
@@ -77,6 +110,7 @@
 #include <pycpp/sfinae/is_specialization.h>
 #include <pycpp/stl/string.h>
 #include <pycpp/stl/type_traits.h>
+#include <stddef.h>
 
 PYCPP_BEGIN_NAMESPACE
 
@@ -88,6 +122,21 @@ namespace str_detail
 template <typename CharP, typename T>
 using is_char_t = is_same<CharP, remove_cvref_t<decay_t<T>>>;
 
+template <typename C>
+using is_char_type = bool_constant<
+    is_same<C, char>::value     || is_same<C, wchar_t>::value  ||
+    is_same<C, char16_t>::value || is_same<C, char32_t>::value
+#if defined(__cpp_char8_t)
+    || is_same<C, char8_t>::value
+#endif
+>;
+
+template <typename T>
+using is_char_array = bool_constant<
+    is_array<T>::value && extent<T>::value != 0 &&
+    is_char_type<remove_cv_t<remove_extent_t<T>>>::value
+>;
+
 }   /* str_detail */
 
 // SFINAE
@@ -142,6 +191,80 @@ using is_string = integral_constant<
     is_stl_string<T>::value
 >;
 
+// ARRAY
+
+template <typename T>
+using is_char_array = str_detail::is_char_array<remove_cvref_t<T>>;
+
+/**
+ *  Number of characters in a character array, including any null
+ *  terminator, or 0 if `T` is not a character array.
+ */
+template <typename T>
+using string_extent = integral_constant<size_t, is_char_array<T>::value ? extent<remove_cvref_t<T>>::value : 0>;
+
+// POLICIES
+// --------
+
+/**
+ *  \brief Assert a character array is a string literal, ending with
+ *  its only null character.
+ */
+struct string_literal_t
+{};
+
+// FUNCTORS
+// --------
+
+/**
+ *  \brief Get the length of a string, excluding the null terminator.
+ */
+struct string_size
+{
+    template <typename C, size_t N>
+    enable_if_t<str_detail::is_char_type<C>::value, size_t>
+    operator()(
+        const C (&s)[N]
+    )
+    const noexcept
+    {
+        const C* null = char_traits<C>::find(s, N, C());
+        return null ? static_cast<size_t>(null - s) : N;
+    }
+
+    template <typename C, size_t N>
+    constexpr
+    enable_if_t<str_detail::is_char_type<C>::value, size_t>
+    operator()(
+        const C (&)[N],
+        string_literal_t
+    )
+    const noexcept
+    {
+        return N - 1;
+    }
+
+    template <typename C, typename Traits, typename Allocator>
+    size_t
+    operator()(
+        const basic_string<C, Traits, Allocator> &s
+    )
+    const noexcept
+    {
+        return s.size();
+    }
+
+    template <typename P>
+    enable_if_t<is_pointer<P>::value && str_detail::is_char_type<remove_cv_t<remove_pointer_t<P>>>::value, size_t>
+    operator()(
+        const P &s
+    )
+    const noexcept
+    {
+        return char_traits<remove_cv_t<remove_pointer_t<P>>>::length(s);
+    }
+};
+
 #ifdef PYCPP_CPP14
 
 // SFINAE
@@ -177,6 +300,12 @@ constexpr bool is_stl_string_v = is_stl_string<T>::value;
 template <typename T>
 constexpr bool is_string_v = is_string<T>::value;
 
+template <typename T>
+constexpr bool is_char_array_v = is_char_array<T>::value;
+
+template <typename T>
+constexpr size_t string_extent_v = string_extent<T>::value;
+
 #endif
 
 PYCPP_END_NAMESPACE
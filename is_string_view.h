@@ -0,0 +1,182 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Type detection for string views and string-like types.
+ *
+ *  Detect `basic_string_view`, and any type that may be viewed as
+ *  a string: character pointers, character arrays, `basic_string`,
+ *  and `basic_string_view`. `as_string_view` converts any string-like
+ *  value to the matching `basic_string_view`, without allocation.
+ *
+ *  Character arrays are sized with `string_size`, so they are viewed
+ *  up to the first null character, scanning at most the array extent.
+ *
+ *  \synopsis
+ *      template <typename T>
+ *      using is_string_view = implementation-defined;
+ *
+ *      template <typename T>
+ *      using is_string_like = implementation-defined;
+ *
+ *      template <typename T>
+ *      using string_char_t = implementation-defined;
+ *
+ *      template <typename T>
+ *      using string_view_t = implementation-defined;
+ *
+ *      struct as_string_view
+ *      {
+ *          template <typename T>
+ *          string_view_t<T> operator()(const T& t) const noexcept;
+ *      };
+ *
+ *      #if PYCPP_CPP14
+ *
+ *      template <typename T>
+ *      constexpr bool is_string_view_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool is_string_like_v = implementation-defined;
+ *
+ *      #endif
+ */
+
+#pragma once
+
+#include <pycpp/sfinae/is_specialization.h>
+#include <pycpp/sfinae/is_string.h>
+#include <pycpp/stl/string.h>
+#include <pycpp/stl/string_view.h>
+#include <pycpp/stl/type_traits.h>
+#include <stddef.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace str_detail
+{
+// SFINAE
+// ------
+
+template <typename T>
+using is_char_pointer = bool_constant<
+    is_pointer<T>::value &&
+    is_char_type<remove_cv_t<remove_pointer_t<T>>>::value
+>;
+
+/**
+ *  Character and traits types of each string-like type.
+ */
+template <typename T, typename = void>
+struct string_types
+{};
+
+template <typename T>
+struct string_types<T, enable_if_t<is_char_pointer<T>::value>>
+{
+    using char_type = remove_cv_t<remove_pointer_t<T>>;
+    using traits_type = char_traits<char_type>;
+};
+
+template <typename T>
+struct string_types<T, enable_if_t<is_char_array<T>::value>>
+{
+    using char_type = remove_cv_t<remove_extent_t<T>>;
+    using traits_type = char_traits<char_type>;
+};
+
+template <typename T>
+struct string_types<T, enable_if_t<is_stl_string<T>::value || is_specialization<T, basic_string_view>::value>>
+{
+    using char_type = typename T::value_type;
+    using traits_type = typename T::traits_type;
+};
+
+}   /* str_detail */
+
+// SFINAE
+// ------
+
+template <typename T>
+using is_string_view = is_specialization<remove_cvref_t<T>, basic_string_view>;
+
+template <typename T>
+using is_string_like = bool_constant<
+    str_detail::is_char_pointer<remove_cvref_t<T>>::value ||
+    str_detail::is_char_array<remove_cvref_t<T>>::value   ||
+    is_stl_string<remove_cvref_t<T>>::value               ||
+    is_string_view<T>::value
+>;
+
+template <typename T>
+using string_char_t = typename str_detail::string_types<remove_cvref_t<T>>::char_type;
+
+template <typename T>
+using string_view_t = basic_string_view<
+    string_char_t<T>,
+    typename str_detail::string_types<remove_cvref_t<T>>::traits_type
+>;
+
+// FUNCTORS
+// --------
+
+/**
+ *  \brief View a string-like value as a `basic_string_view`.
+ */
+struct as_string_view
+{
+    template <typename C, typename Traits, typename Allocator>
+    basic_string_view<C, Traits>
+    operator()(
+        const basic_string<C, Traits, Allocator> &s
+    )
+    const noexcept
+    {
+        return basic_string_view<C, Traits>(s.data(), s.size());
+    }
+
+    template <typename C, typename Traits>
+    basic_string_view<C, Traits>
+    operator()(
+        basic_string_view<C, Traits> s
+    )
+    const noexcept
+    {
+        return s;
+    }
+
+    template <typename C, size_t N>
+    enable_if_t<str_detail::is_char_type<remove_cv_t<C>>::value, basic_string_view<remove_cv_t<C>>>
+    operator()(
+        C (&s)[N]
+    )
+    const noexcept
+    {
+        return basic_string_view<remove_cv_t<C>>(s, string_size()(s));
+    }
+
+    template <typename P>
+    enable_if_t<str_detail::is_char_pointer<P>::value, string_view_t<P>>
+    operator()(
+        const P &s
+    )
+    const noexcept
+    {
+        return string_view_t<P>(s);
+    }
+};
+
+#ifdef PYCPP_CPP14
+
+// SFINAE
+// ------
+
+template <typename T>
+constexpr bool is_string_view_v = is_string_view<T>::value;
+
+template <typename T>
+constexpr bool is_string_like_v = is_string_like<T>::value;
+
+#endif
+
+PYCPP_END_NAMESPACE
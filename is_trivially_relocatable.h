@@ -0,0 +1,194 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Type detection for trivially relocatable types.
+ *
+ *  Detect if a type may be relocated (moved to a new address, and
+ *  the original destroyed) by a bitwise copy. Trivially copyable
+ *  types, `std::complex`, `std::reference_wrapper`, and `std::pair`
+ *  or `std::tuple` of trivially relocatable types are detected
+ *  automatically. Other types may opt-in by specializing
+ *  `is_trivially_relocatable` for the unqualified type, which also
+ *  applies to the cv-qualified type.
+ *
+ *  \synopsis
+ *      template <typename T>
+ *      struct is_trivially_relocatable: implementation-defined
+ *      {};
+ *
+ *      struct relocate
+ *      {
+ *          template <typename T>
+ *          T* operator()(T* first, T* last, T* dest);
+ *      };
+ *
+ *      #if PYCPP_CPP14
+ *
+ *      template <typename T>
+ *      constexpr bool is_trivially_relocatable_v = implementation-defined;
+ *
+ *      #endif
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/all_of.h>
+#include <pycpp/sfinae/is_complex.h>
+#include <pycpp/sfinae/is_pair.h>
+#include <pycpp/sfinae/is_reference_wrapper.h>
+#include <pycpp/sfinae/is_tuple.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
+#include <new>
+#include <stddef.h>
+#include <string.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+// FORWARD
+// -------
+
+template <typename T>
+struct is_trivially_relocatable;
+
+namespace relocate_detail
+{
+// SFINAE
+// ------
+
+/**
+ *  Check if every template argument of a `pair` or `tuple`
+ *  is trivially relocatable.
+ */
+template <typename T>
+struct members_relocatable: false_type
+{};
+
+template <template <typename...> class C, typename... Ts>
+struct members_relocatable<C<Ts...>>: sfinae_detail::all_of<is_trivially_relocatable<Ts>::value...>
+{};
+
+template <typename T>
+using is_product = bool_constant<is_pair<T>::value || is_tuple<T>::value>;
+
+template <typename T>
+using is_relocatable = bool_constant<
+    is_trivially_copyable<T>::value ||
+    is_complex<T>::value            ||
+    is_reference_wrapper<T>::value  ||
+    (is_product<T>::value && members_relocatable<T>::value)
+>;
+
+}   /* relocate_detail */
+
+// SFINAE
+// ------
+
+/**
+ *  Specialize to `true_type` for types that may be relocated
+ *  with `memcpy`, such as types with an owning pointer.
+ */
+template <typename T>
+struct is_trivially_relocatable: relocate_detail::is_relocatable<T>
+{};
+
+/**
+ *  Cv-qualified types use the trait, or the specialization, of
+ *  the unqualified type.
+ */
+template <typename T>
+struct is_trivially_relocatable<const T>: is_trivially_relocatable<T>
+{};
+
+template <typename T>
+struct is_trivially_relocatable<volatile T>: is_trivially_relocatable<T>
+{};
+
+template <typename T>
+struct is_trivially_relocatable<const volatile T>: is_trivially_relocatable<T>
+{};
+
+/**
+ *  \brief Relocate a buffer of items to uninitialized memory.
+ *
+ *  Move-constructs each item in `[first, last)` into `dest`
+ *  and destroys the source item. Trivially relocatable types
+ *  are relocated with a single `memmove`, and may overlap. For
+ *  other types, `dest` must not lie within `(first, last)`.
+ *  Returns a pointer past the last relocated item.
+ */
+struct relocate
+{
+#if defined(PYCPP_CPP20)
+
+    template <typename T>
+    T*
+    operator()(
+        T* first,
+        T* last,
+        T* dest
+    )
+    {
+        if constexpr (is_trivially_relocatable<T>::value) {
+            size_t n = static_cast<size_t>(last - first);
+            if (n) {
+                memmove(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+            }
+            return dest + n;
+        } else {
+            for (; first != last; ++first, ++dest) {
+                ::new (static_cast<void*>(dest)) T(move(*first));
+                first->~T();
+            }
+            return dest;
+        }
+    }
+
+#else
+
+    template <typename T>
+    enable_if_t<is_trivially_relocatable<T>::value, T*>
+    operator()(
+        T* first,
+        T* last,
+        T* dest
+    )
+    {
+        size_t n = static_cast<size_t>(last - first);
+        if (n) {
+            memmove(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+        }
+        return dest + n;
+    }
+
+    template <typename T>
+    enable_if_t<!is_trivially_relocatable<T>::value, T*>
+    operator()(
+        T* first,
+        T* last,
+        T* dest
+    )
+    {
+        for (; first != last; ++first, ++dest) {
+            ::new (static_cast<void*>(dest)) T(move(*first));
+            first->~T();
+        }
+        return dest;
+    }
+
+#endif
+};
+
+#ifdef PYCPP_CPP14
+
+// SFINAE
+// ------
+
+template <typename T>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+#endif
+
+PYCPP_END_NAMESPACE
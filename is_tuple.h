@@ -21,6 +21,7 @@
 #pragma once
 
 #include <pycpp/sfinae/is_specialization.h>
+#include <pycpp/stl/tuple.h>
 
 PYCPP_BEGIN_NAMESPACE
 
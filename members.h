@@ -0,0 +1,15 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Member function, type, and variable detection.
+ *
+ *  Macros to detect members of a class.
+ */
+
+#pragma once
+
+#include <pycpp/sfinae/container_traits.h>
+#include <pycpp/sfinae/has_member_function.h>
+#include <pycpp/sfinae/has_member_type.h>
+#include <pycpp/sfinae/has_member_variable.h>
@@ -0,0 +1,42 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Operator detection.
+ *
+ *  Detectors for supported operators, which only depend on
+ *  `<type_traits>` and `<utility>`.
+ */
+
+#pragma once
+
+#include <pycpp/sfinae/has_bit_and.h>
+#include <pycpp/sfinae/has_bit_and_assign.h>
+#include <pycpp/sfinae/has_bit_or.h>
+#include <pycpp/sfinae/has_bit_or_assign.h>
+#include <pycpp/sfinae/has_bit_xor.h>
+#include <pycpp/sfinae/has_bit_xor_assign.h>
+#include <pycpp/sfinae/has_divides.h>
+#include <pycpp/sfinae/has_divides_assign.h>
+#include <pycpp/sfinae/has_equal_to.h>
+#include <pycpp/sfinae/has_greater.h>
+#include <pycpp/sfinae/has_greater_equal.h>
+#include <pycpp/sfinae/has_left_shift.h>
+#include <pycpp/sfinae/has_left_shift_assign.h>
+#include <pycpp/sfinae/has_less.h>
+#include <pycpp/sfinae/has_less_equal.h>
+#include <pycpp/sfinae/has_logical_and.h>
+#include <pycpp/sfinae/has_logical_or.h>
+#include <pycpp/sfinae/has_minus.h>
+#include <pycpp/sfinae/has_minus_assign.h>
+#include <pycpp/sfinae/has_modulus.h>
+#include <pycpp/sfinae/has_modulus_assign.h>
+#include <pycpp/sfinae/has_multiplies.h>
+#include <pycpp/sfinae/has_multiplies_assign.h>
+#include <pycpp/sfinae/has_not_equal_to.h>
+#include <pycpp/sfinae/has_op.h>
+#include <pycpp/sfinae/has_plus.h>
+#include <pycpp/sfinae/has_plus_assign.h>
+#include <pycpp/sfinae/has_right_shift.h>
+#include <pycpp/sfinae/has_right_shift_assign.h>
+#include <pycpp/sfinae/has_subscript.h>
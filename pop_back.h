@@ -8,13 +8,19 @@
  *
  *  \synopsis
  *      template <typename T>
- *      struct has_pop_back: implementation_defined
+ *      using has_pop_back = bool_constant<container_traits<T>::has_pop_back>;
+ *
+ *      template <typename T>
+ *      struct is_nothrow_pop_back: implementation_defined
  *      {};
  *
  *      struct pop_back
  *      {
  *          template <typename T>
- *          void operator()(T& t);
+ *          constexpr void operator()(T& t) noexcept(is_nothrow_pop_back<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr void operator()(allow_fallback_t, T& t) noexcept(is_nothrow_pop_back<T>::value);
  *      };
  *
  *      #if PYCPP_CPP14
@@ -22,21 +28,53 @@
  *      template <typename T>
  *      constexpr bool has_pop_back_v = implementation-defined;
  *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_pop_back_v = implementation-defined;
+ *
  *      #endif
  */
 
 #pragma once
 
-#include <pycpp/sfinae/has_member_function.h>
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/container_traits.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/profile.h>
 #include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
 
 PYCPP_BEGIN_NAMESPACE
 
+namespace pop_back_detail
+{
 // SFINAE
 // ------
 
-PYCPP_HAS_MEMBER_FUNCTION(pop_back, has_pop_back, void (C::*)());
+template <bool Native, typename T>
+struct is_nothrow: bool_constant<noexcept(declval<T&>().pop_back())>
+{};
+
+template <typename T>
+struct is_nothrow<false, T>: bool_constant<noexcept(declval<T&>().erase(--declval<T&>().end()))>
+{};
+
+}   /* pop_back_detail */
 
+// SFINAE
+// ------
+
+/**
+ *  Detect a native `pop_back`, from `container_traits`.
+ */
+template <typename T>
+using has_pop_back = bool_constant<container_traits<T>::has_pop_back>;
+
+/**
+ *  Detect if the call selected by `pop_back` cannot throw.
+ */
+template <typename T>
+using is_nothrow_pop_back = pop_back_detail::is_nothrow<container_traits<T>::has_pop_back, T>;
 
 /**
  *  \brief Call `pop_back` as a functor.
@@ -45,19 +83,64 @@ PYCPP_HAS_MEMBER_FUNCTION(pop_back, has_pop_back, void (C::*)());
  */
 struct pop_back
 {
-    template <typename T>
-    enable_if_t<has_pop_back<T>::value, void>
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(T &t)
+    noexcept(is_nothrow_pop_back<T>::value)
+    {
+        if constexpr (container_traits<T>::has_pop_back) {
+            PYCPP_SFINAE_PROFILE_SCOPE(pop_back, T, true);
+            t.pop_back();
+        } else {
+            PYCPP_SFINAE_REQUIRE_COMPLEXITY(pop_back, T, AllowFallback);
+            PYCPP_SFINAE_PROFILE_SCOPE(pop_back, T, false);
+            t.erase(--t.end());
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_pop_back, void>
     operator()(T &t)
+    noexcept(is_nothrow_pop_back<T>::value)
     {
+        PYCPP_SFINAE_PROFILE_SCOPE(pop_back, T, true);
         t.pop_back();
     }
 
-    template <typename T>
-    enable_if_t<!has_pop_back<T>::value, void>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_pop_back, void>
     operator()(T &t)
+    noexcept(is_nothrow_pop_back<T>::value)
     {
+        PYCPP_SFINAE_REQUIRE_COMPLEXITY(pop_back, T, AllowFallback);
+        PYCPP_SFINAE_PROFILE_SCOPE(pop_back, T, false);
         t.erase(--t.end());
     }
+
+#endif
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        allow_fallback_t,
+        T &t
+    )
+    noexcept(is_nothrow_pop_back<T>::value)
+    {
+        this->template operator()<true>(t);
+    }
 };
 
 #ifdef PYCPP_CPP14
@@ -66,8 +149,17 @@ struct pop_back
 // ------
 
 template <typename T>
-constexpr bool has_pop_back_v = has_pop_back<T>::value;
+constexpr bool has_pop_back_v = container_traits<T>::has_pop_back;
+
+template <typename T>
+constexpr bool is_nothrow_pop_back_v = is_nothrow_pop_back<T>::value;
 
 #endif
 
 PYCPP_END_NAMESPACE
+
+// Strict mode checks the cost of the fallback, from `complexity.h`,
+// unless a batch functor includes it once the batch functor is defined.
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY) && !defined(PYCPP_SFINAE_DETAIL_DEFER_COMPLEXITY)
+#   include <pycpp/sfinae/complexity.h>
+#endif
@@ -8,13 +8,19 @@
  *
  *  \synopsis
  *      template <typename T>
- *      struct has_pop_front: implementation_defined
+ *      using has_pop_front = bool_constant<container_traits<T>::has_pop_front>;
+ *
+ *      template <typename T>
+ *      struct is_nothrow_pop_front: implementation_defined
  *      {};
  *
  *      struct pop_front
  *      {
  *          template <typename T>
- *          void operator()(T& t);
+ *          constexpr void operator()(T& t) noexcept(is_nothrow_pop_front<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr void operator()(allow_fallback_t, T& t) noexcept(is_nothrow_pop_front<T>::value);
  *      };
  *
  *      #if PYCPP_CPP14
@@ -22,44 +28,123 @@
  *      template <typename T>
  *      constexpr bool has_pop_front_v = implementation-defined;
  *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_pop_front_v = implementation-defined;
+ *
  *      #endif
  */
 
 #pragma once
 
-#include <pycpp/sfinae/has_member_function.h>
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/container_traits.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/profile.h>
 #include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
 
 PYCPP_BEGIN_NAMESPACE
 
+namespace pop_front_detail
+{
+// SFINAE
+// ------
+
+template <bool Native, typename T>
+struct is_nothrow: bool_constant<noexcept(declval<T&>().pop_front())>
+{};
+
+template <typename T>
+struct is_nothrow<false, T>: bool_constant<noexcept(declval<T&>().erase(declval<T&>().begin()))>
+{};
+
+}   /* pop_front_detail */
+
 // SFINAE
 // ------
 
-PYCPP_HAS_MEMBER_FUNCTION(pop_front, has_pop_front, void (C::*)());
+/**
+ *  Detect a native `pop_front`, from `container_traits`.
+ */
+template <typename T>
+using has_pop_front = bool_constant<container_traits<T>::has_pop_front>;
 
+/**
+ *  Detect if the call selected by `pop_front` cannot throw.
+ */
+template <typename T>
+using is_nothrow_pop_front = pop_front_detail::is_nothrow<container_traits<T>::has_pop_front, T>;
 
 /**
  *  \brief Call `pop_front` as a functor.
  */
 struct pop_front
 {
-    template <typename T>
-    enable_if_t<has_pop_front<T>::value, void>
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
     operator()(
         T &t
     )
+    noexcept(is_nothrow_pop_front<T>::value)
     {
+        if constexpr (container_traits<T>::has_pop_front) {
+            PYCPP_SFINAE_PROFILE_SCOPE(pop_front, T, true);
+            t.pop_front();
+        } else {
+            PYCPP_SFINAE_REQUIRE_COMPLEXITY(pop_front, T, AllowFallback);
+            PYCPP_SFINAE_PROFILE_SCOPE(pop_front, T, false);
+            t.erase(t.begin());
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_pop_front, void>
+    operator()(
+        T &t
+    )
+    noexcept(is_nothrow_pop_front<T>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(pop_front, T, true);
         t.pop_front();
     }
 
-    template <typename T>
-    enable_if_t<!has_pop_front<T>::value, void>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_pop_front, void>
     operator()(
         T &t
     )
+    noexcept(is_nothrow_pop_front<T>::value)
     {
+        PYCPP_SFINAE_REQUIRE_COMPLEXITY(pop_front, T, AllowFallback);
+        PYCPP_SFINAE_PROFILE_SCOPE(pop_front, T, false);
         t.erase(t.begin());
     }
+
+#endif
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        allow_fallback_t,
+        T &t
+    )
+    noexcept(is_nothrow_pop_front<T>::value)
+    {
+        this->template operator()<true>(t);
+    }
 };
 
 #ifdef PYCPP_CPP14
@@ -68,8 +153,17 @@ struct pop_front
 // ------
 
 template <typename T>
-constexpr bool has_pop_front_v = has_pop_front<T>::value;
+constexpr bool has_pop_front_v = container_traits<T>::has_pop_front;
+
+template <typename T>
+constexpr bool is_nothrow_pop_front_v = is_nothrow_pop_front<T>::value;
 
 #endif
 
 PYCPP_END_NAMESPACE
+
+// Strict mode checks the cost of the fallback, from `complexity.h`,
+// unless a batch functor includes it once the batch functor is defined.
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY) && !defined(PYCPP_SFINAE_DETAIL_DEFER_COMPLEXITY)
+#   include <pycpp/sfinae/complexity.h>
+#endif
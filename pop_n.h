@@ -0,0 +1,430 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief SFINAE detection for range erasure and batched pops.
+ *
+ *  Remove `n` items from the front or back of the container at once,
+ *  using range `erase` if available, then `resize` (back only), and
+ *  only then removing items one at a time. Range `erase` from the
+ *  back requires bidirectional iterators. Draining `n` items from the
+ *  front of a `vector` is therefore a single move of the remaining
+ *  items, rather than `n`. Iterator movement is assumed not to throw
+ *  when detecting whether the functors may throw.
+ *
+ *  Passing `allow_fallback_t` forwards the opt-in to `pop_front` or
+ *  `pop_back` when items are removed one at a time, in strict mode.
+ *
+ *  \synopsis
+ *      template <typename T>
+ *      struct has_range_erase: implementation_defined
+ *      {};
+ *
+ *      template <typename T>
+ *      struct has_resize: implementation_defined
+ *      {};
+ *
+ *      template <typename T>
+ *      struct is_nothrow_pop_front_n: implementation_defined
+ *      {};
+ *
+ *      template <typename T>
+ *      struct is_nothrow_pop_back_n: implementation_defined
+ *      {};
+ *
+ *      struct pop_front_n
+ *      {
+ *          template <typename T>
+ *          constexpr void operator()(T& t, size_t n) noexcept(is_nothrow_pop_front_n<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr void operator()(allow_fallback_t, T& t, size_t n) noexcept(is_nothrow_pop_front_n<T>::value);
+ *      };
+ *
+ *      struct pop_back_n
+ *      {
+ *          template <typename T>
+ *          constexpr void operator()(T& t, size_t n) noexcept(is_nothrow_pop_back_n<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr void operator()(allow_fallback_t, T& t, size_t n) noexcept(is_nothrow_pop_back_n<T>::value);
+ *      };
+ *
+ *      #if PYCPP_CPP20
+ *
+ *      template <typename T>
+ *      concept supports_range_erase = implementation-defined;
+ *
+ *      template <typename T>
+ *      concept supports_resize = implementation-defined;
+ *
+ *      #endif
+ *
+ *      #if PYCPP_CPP14
+ *
+ *      template <typename T>
+ *      constexpr bool has_range_erase_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool has_resize_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_pop_front_n_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_pop_back_n_v = implementation-defined;
+ *
+ *      #endif
+ */
+
+#pragma once
+
+// `complexity.h` specializes `complexity` for the batch functors, so
+// it is only included once they are defined.
+#define PYCPP_SFINAE_DETAIL_DEFER_COMPLEXITY
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/pop_back.h>
+#include <pycpp/sfinae/pop_front.h>
+#include <pycpp/sfinae/profile.h>
+#include <pycpp/stl/iterator.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
+#include <stddef.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+// SFINAE
+// ------
+
+#if defined(PYCPP_CPP20)
+
+/**
+ *  Detect `t.erase(first, last)`.
+ */
+template <typename T>
+concept supports_range_erase = requires(T& t) {
+    t.erase(t.begin(), t.end());
+};
+
+template <typename T>
+using has_range_erase = bool_constant<supports_range_erase<T>>;
+
+/**
+ *  Detect `t.resize(n)`, for a default-constructible `value_type`.
+ */
+template <typename T>
+concept supports_resize = is_default_constructible<typename T::value_type>::value && requires(T& t, typename T::size_type n) {
+    t.resize(n);
+};
+
+template <typename T>
+using has_resize = bool_constant<supports_resize<T>>;
+
+#else
+
+/**
+ *  Detect `t.erase(first, last)`.
+ */
+template <typename T, typename = void>
+struct has_range_erase_impl: false_type
+{};
+
+template <typename T>
+struct has_range_erase_impl<T, void_t<decltype(declval<T&>().erase(declval<T&>().begin(), declval<T&>().end()))>>: true_type
+{};
+
+template <typename T>
+using has_range_erase = has_range_erase_impl<T>;
+
+/**
+ *  Detect `t.resize(n)`, for a default-constructible `value_type`.
+ */
+template <typename T, typename = void>
+struct has_resize_impl: false_type
+{};
+
+template <typename T>
+struct has_resize_impl<T, void_t<decltype(declval<T&>().resize(declval<typename T::size_type>()))>>:
+    is_default_constructible<typename T::value_type>
+{};
+
+template <typename T>
+using has_resize = has_resize_impl<T>;
+
+#endif
+
+namespace pop_n_detail
+{
+// SFINAE
+// ------
+
+template <typename T, typename = void>
+struct is_bidirectional: false_type
+{};
+
+template <typename T>
+struct is_bidirectional<T, void_t<typename iterator_traits<typename T::iterator>::iterator_category>>:
+    is_base_of<bidirectional_iterator_tag, typename iterator_traits<typename T::iterator>::iterator_category>
+{};
+
+template <typename T>
+using use_front_range_erase = has_range_erase<T>;
+
+/**
+ *  Erasing from the back steps back from `end()`, which requires
+ *  bidirectional iterators.
+ */
+template <typename T>
+using use_back_range_erase = bool_constant<has_range_erase<T>::value && is_bidirectional<T>::value>;
+
+template <typename T>
+using use_resize = bool_constant<!use_back_range_erase<T>::value && has_resize<T>::value>;
+
+template <typename T>
+using use_pop_back = bool_constant<!use_back_range_erase<T>::value && !use_resize<T>::value>;
+
+template <typename T>
+using use_pop_front = bool_constant<!use_front_range_erase<T>::value>;
+
+template <typename T, typename = void>
+struct is_nothrow_front: is_nothrow_pop_front<T>
+{};
+
+template <typename T>
+struct is_nothrow_front<T, enable_if_t<use_front_range_erase<T>::value>>: bool_constant<noexcept(declval<T&>().erase(declval<T&>().begin(), declval<T&>().end()))>
+{};
+
+template <typename T, typename = void>
+struct is_nothrow_back: is_nothrow_pop_back<T>
+{};
+
+template <typename T>
+struct is_nothrow_back<T, enable_if_t<use_back_range_erase<T>::value>>: bool_constant<noexcept(declval<T&>().erase(declval<T&>().begin(), declval<T&>().end()))>
+{};
+
+template <typename T>
+struct is_nothrow_back<T, enable_if_t<use_resize<T>::value>>: bool_constant<noexcept(declval<T&>().resize(declval<T&>().size()))>
+{};
+
+}   /* pop_n_detail */
+
+// SFINAE
+// ------
+
+/**
+ *  Detect if the calls selected by `pop_front_n` cannot throw.
+ */
+template <typename T>
+using is_nothrow_pop_front_n = pop_n_detail::is_nothrow_front<T>;
+
+/**
+ *  Detect if the calls selected by `pop_back_n` cannot throw.
+ */
+template <typename T>
+using is_nothrow_pop_back_n = pop_n_detail::is_nothrow_back<T>;
+
+
+/**
+ *  \brief Remove `n` items from the front of the container as a functor.
+ */
+struct pop_front_n
+{
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t,
+        size_t n
+    )
+    noexcept(is_nothrow_pop_front_n<T>::value)
+    {
+        if constexpr (pop_n_detail::use_front_range_erase<T>::value) {
+            PYCPP_SFINAE_PROFILE_SCOPE(pop_front_n, T, true);
+            auto first = t.begin();
+            t.erase(first, next(first, static_cast<typename T::difference_type>(n)));
+        } else {
+            PYCPP_SFINAE_PROFILE_SCOPE(pop_front_n, T, false);
+            for (; n; --n) {
+                pop_front().template operator()<AllowFallback>(t);
+            }
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<pop_n_detail::use_front_range_erase<T>::value, void>
+    operator()(
+        T &t,
+        size_t n
+    )
+    noexcept(is_nothrow_pop_front_n<T>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(pop_front_n, T, true);
+        auto first = t.begin();
+        t.erase(first, next(first, static_cast<typename T::difference_type>(n)));
+    }
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<pop_n_detail::use_pop_front<T>::value, void>
+    operator()(
+        T &t,
+        size_t n
+    )
+    noexcept(is_nothrow_pop_front_n<T>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(pop_front_n, T, false);
+        for (; n; --n) {
+            pop_front().template operator()<AllowFallback>(t);
+        }
+    }
+
+#endif
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        allow_fallback_t,
+        T &t,
+        size_t n
+    )
+    noexcept(is_nothrow_pop_front_n<T>::value)
+    {
+        this->template operator()<true>(t, n);
+    }
+};
+
+
+/**
+ *  \brief Remove `n` items from the back of the container as a functor.
+ */
+struct pop_back_n
+{
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t,
+        size_t n
+    )
+    noexcept(is_nothrow_pop_back_n<T>::value)
+    {
+        if constexpr (pop_n_detail::use_back_range_erase<T>::value) {
+            PYCPP_SFINAE_PROFILE_SCOPE(pop_back_n, T, true);
+            auto last = t.end();
+            t.erase(prev(last, static_cast<typename T::difference_type>(n)), last);
+        } else if constexpr (pop_n_detail::use_resize<T>::value) {
+            PYCPP_SFINAE_PROFILE_SCOPE(pop_back_n, T, true);
+            t.resize(t.size() - n);
+        } else {
+            PYCPP_SFINAE_PROFILE_SCOPE(pop_back_n, T, false);
+            for (; n; --n) {
+                pop_back().template operator()<AllowFallback>(t);
+            }
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<pop_n_detail::use_back_range_erase<T>::value, void>
+    operator()(
+        T &t,
+        size_t n
+    )
+    noexcept(is_nothrow_pop_back_n<T>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(pop_back_n, T, true);
+        auto last = t.end();
+        t.erase(prev(last, static_cast<typename T::difference_type>(n)), last);
+    }
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<pop_n_detail::use_resize<T>::value, void>
+    operator()(
+        T &t,
+        size_t n
+    )
+    noexcept(is_nothrow_pop_back_n<T>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(pop_back_n, T, true);
+        t.resize(t.size() - n);
+    }
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<pop_n_detail::use_pop_back<T>::value, void>
+    operator()(
+        T &t,
+        size_t n
+    )
+    noexcept(is_nothrow_pop_back_n<T>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(pop_back_n, T, false);
+        for (; n; --n) {
+            pop_back().template operator()<AllowFallback>(t);
+        }
+    }
+
+#endif
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        allow_fallback_t,
+        T &t,
+        size_t n
+    )
+    noexcept(is_nothrow_pop_back_n<T>::value)
+    {
+        this->template operator()<true>(t, n);
+    }
+};
+
+#ifdef PYCPP_CPP14
+
+// SFINAE
+// ------
+
+template <typename T>
+constexpr bool has_range_erase_v = has_range_erase<T>::value;
+
+template <typename T>
+constexpr bool has_resize_v = has_resize<T>::value;
+
+template <typename T>
+constexpr bool is_nothrow_pop_front_n_v = is_nothrow_pop_front_n<T>::value;
+
+template <typename T>
+constexpr bool is_nothrow_pop_back_n_v = is_nothrow_pop_back_n<T>::value;
+
+#endif
+
+PYCPP_END_NAMESPACE
+
+// Strict mode checks the cost of the fallback, from `complexity.h`.
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY)
+#   include <pycpp/sfinae/complexity.h>
+#endif
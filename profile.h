@@ -0,0 +1,484 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Opt-in profiling of the fail-safe functor paths.
+ *
+ *  When `PYCPP_SFINAE_PROFILE` is defined, the container functors
+ *  count the calls taking the native member function, and the calls
+ *  taking the fallback (for example, `insert` or `erase` rather than
+ *  `push_front` or `pop_front`), separately for each functor and
+ *  container type. Fallbacks may change the complexity of a call from
+ *  constant to linear, so these counters find hidden quadratic loops.
+ *  Otherwise, this header is empty, and the instrumentation expands
+ *  to nothing (see `attributes.h`).
+ *
+ *  If `PYCPP_SFINAE_PROFILE_TICKS` is also defined, the time spent in
+ *  each path is recorded, in TSC cycles on x86, and nanoseconds
+ *  otherwise.
+ *
+ *  Counters are thread-local, so counting does not synchronize. The
+ *  counters of each thread are merged into a global table when the
+ *  thread exits. `profile_snapshot` returns the global table and the
+ *  counters of the calling thread. Registering the counters of a new
+ *  functor and container type allocates, and if that fails, the call
+ *  is not counted, since the functors may be `noexcept`.
+ *
+ *  \synopsis
+ *      #define PYCPP_SFINAE_PROFILE_SCOPE(functor, T, native) implementation-defined
+ *
+ *      #if PYCPP_SFINAE_PROFILE
+ *
+ *      enum class profile_format
+ *      {
+ *          text,
+ *          json,
+ *      };
+ *
+ *      struct profile_record
+ *      {
+ *          string functor;
+ *          string container;
+ *          uint64_t native;
+ *          uint64_t fallback;
+ *          uint64_t native_ticks;
+ *          uint64_t fallback_ticks;
+ *      };
+ *
+ *      vector<profile_record> profile_snapshot();
+ *      void profile_reset();
+ *      void profile_dump(FILE* stream, profile_format format);
+ *      void profile_dump_at_exit(profile_format format, FILE* stream = stderr);
+ *
+ *      #endif
+ */
+
+#pragma once
+
+#if defined(PYCPP_SFINAE_PROFILE)
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/stl/string.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/vector.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <typeinfo>
+#include <utility>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__GNUG__)
+#   include <cxxabi.h>
+#endif
+
+#if defined(PYCPP_SFINAE_PROFILE_TICKS) && (defined(__x86_64__) || defined(__i386__))
+#   include <x86intrin.h>
+#elif defined(PYCPP_SFINAE_PROFILE_TICKS) && (defined(_M_X64) || defined(_M_IX86))
+#   include <intrin.h>
+#endif
+
+PYCPP_BEGIN_NAMESPACE
+
+// OBJECTS
+// -------
+
+/**
+ *  \brief Output format for `profile_dump`.
+ */
+enum class profile_format
+{
+    text,
+    json,
+};
+
+/**
+ *  \brief Calls through each path of a functor, for one container type.
+ */
+struct profile_record
+{
+    string functor;
+    string container;
+    uint64_t native = 0;
+    uint64_t fallback = 0;
+    uint64_t native_ticks = 0;
+    uint64_t fallback_ticks = 0;
+};
+
+namespace profile_detail
+{
+// OBJECTS
+// -------
+
+struct counters
+{
+    uint64_t calls[2] = {0, 0};
+    uint64_t ticks[2] = {0, 0};
+};
+
+using key = std::pair<string, string>;
+using table = std::map<key, counters>;
+
+/**
+ *  \brief Counters merged from exited threads.
+ */
+struct global_table
+{
+    std::mutex mutex;
+    table counters;
+    profile_format format = profile_format::text;
+    FILE* stream = nullptr;
+};
+
+// FUNCTIONS
+// ---------
+
+inline
+global_table&
+global()
+{
+    static global_table instance;
+    return instance;
+}
+
+inline
+void
+merge(
+    table &dst,
+    const table &src
+)
+{
+    for (const auto &item: src) {
+        counters &c = dst[item.first];
+        for (int i = 0; i < 2; ++i) {
+            c.calls[i] += item.second.calls[i];
+            c.ticks[i] += item.second.ticks[i];
+        }
+    }
+}
+
+inline
+string
+demangle(
+    const std::type_info &info
+)
+{
+#if defined(__GNUG__)
+    int status = 0;
+    char* name = abi::__cxa_demangle(info.name(), nullptr, nullptr, &status);
+    if (status == 0 && name) {
+        string result(name);
+        free(name);
+        return result;
+    }
+#endif
+    return string(info.name());
+}
+
+inline
+uint64_t
+now()
+{
+#if defined(PYCPP_SFINAE_PROFILE_TICKS) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#else
+    auto time = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+#endif
+}
+
+// OBJECTS
+// -------
+
+/**
+ *  \brief Counters of the current thread, merged on thread exit.
+ */
+struct local_table
+{
+    table counters;
+
+    local_table()
+    {
+        // Construct the global table first, so it outlives this one.
+        global();
+    }
+
+    ~local_table()
+    {
+        // Drop the counters if merging them cannot allocate.
+        try {
+            global_table &g = global();
+            std::lock_guard<std::mutex> lock(g.mutex);
+            merge(g.counters, counters);
+        } catch (...) {
+        }
+    }
+};
+
+inline
+local_table&
+local()
+{
+    static thread_local local_table instance;
+    return instance;
+}
+
+/**
+ *  \brief Register the counters for one functor and container type.
+ *
+ *  The functors may be `noexcept`, so allocation failures return
+ *  null rather than throw, and the sample is dropped.
+ */
+inline
+counters*
+find(
+    const char* functor,
+    const std::type_info &info
+)
+noexcept
+{
+    try {
+        return &local().counters[key(functor, demangle(info))];
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+/**
+ *  \brief Counters for one functor and container type, in the current
+ *  thread, or null if they could not be registered.
+ */
+template <typename Functor, typename T>
+counters*
+slot(
+    const char* functor
+)
+noexcept
+{
+    static thread_local counters* instance = nullptr;
+    if (!instance) {
+        instance = find(functor, typeid(T));
+    }
+    return instance;
+}
+
+/**
+ *  \brief Count a call, and time it if `PYCPP_SFINAE_PROFILE_TICKS` is defined.
+ */
+template <typename Functor, typename T>
+class scope
+{
+public:
+#if defined(PYCPP_CPP20)
+    constexpr
+#endif
+    scope(
+        const char* functor,
+        bool native
+    )
+    noexcept:
+        path_(native ? 0 : 1)
+    {
+#if defined(PYCPP_CPP20)
+        if (std::is_constant_evaluated()) {
+            return;
+        }
+#endif
+        counters_ = slot<Functor, T>(functor);
+        if (counters_) {
+            counters_->calls[path_]++;
+#if defined(PYCPP_SFINAE_PROFILE_TICKS)
+            start_ = now();
+#endif
+        }
+    }
+
+#if defined(PYCPP_CPP20)
+    constexpr
+#endif
+    ~scope()
+    {
+#if defined(PYCPP_CPP20)
+        if (std::is_constant_evaluated()) {
+            return;
+        }
+#endif
+#if defined(PYCPP_SFINAE_PROFILE_TICKS)
+        if (counters_) {
+            counters_->ticks[path_] += now() - start_;
+        }
+#endif
+    }
+
+private:
+    counters* counters_ = nullptr;
+    int path_;
+    uint64_t start_ = 0;
+};
+
+inline
+vector<profile_record>
+records(
+    const table &counters
+)
+{
+    vector<profile_record> result;
+    for (const auto &item: counters) {
+        profile_record record;
+        record.functor = item.first.first;
+        record.container = item.first.second;
+        record.native = item.second.calls[0];
+        record.fallback = item.second.calls[1];
+        record.native_ticks = item.second.ticks[0];
+        record.fallback_ticks = item.second.ticks[1];
+        result.push_back(record);
+    }
+    return result;
+}
+
+inline
+void
+write_json_string(
+    FILE* stream,
+    const string &s
+)
+{
+    fputc('"', stream);
+    for (char c: s) {
+        if (c == '"' || c == '\\') {
+            fputc('\\', stream);
+        }
+        fputc(c, stream);
+    }
+    fputc('"', stream);
+}
+
+inline
+void
+write(
+    FILE* stream,
+    profile_format format,
+    const vector<profile_record> &records
+)
+{
+    if (format == profile_format::json) {
+        fputs("[", stream);
+        for (size_t i = 0; i < records.size(); ++i) {
+            const profile_record &r = records[i];
+            fputs(i ? ",\n {\"functor\": " : "\n {\"functor\": ", stream);
+            write_json_string(stream, r.functor);
+            fputs(", \"container\": ", stream);
+            write_json_string(stream, r.container);
+            fprintf(stream, ", \"native\": %llu, \"fallback\": %llu, \"native_ticks\": %llu, \"fallback_ticks\": %llu}",
+                static_cast<unsigned long long>(r.native),
+                static_cast<unsigned long long>(r.fallback),
+                static_cast<unsigned long long>(r.native_ticks),
+                static_cast<unsigned long long>(r.fallback_ticks));
+        }
+        fputs("\n]\n", stream);
+    } else {
+        fprintf(stream, "%-16s %12s %12s %16s %16s  %s\n", "functor", "native", "fallback", "native_ticks", "fallback_ticks", "container");
+        for (const profile_record &r: records) {
+            fprintf(stream, "%-16s %12llu %12llu %16llu %16llu  %s\n",
+                r.functor.c_str(),
+                static_cast<unsigned long long>(r.native),
+                static_cast<unsigned long long>(r.fallback),
+                static_cast<unsigned long long>(r.native_ticks),
+                static_cast<unsigned long long>(r.fallback_ticks),
+                r.container.c_str());
+        }
+    }
+    fflush(stream);
+}
+
+inline
+void
+dump_at_exit()
+{
+    // The thread-local counters of the main thread are merged before
+    // `atexit` handlers run, and must not be used again.
+    global_table &g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    write(g.stream, g.format, records(g.counters));
+}
+
+}   /* profile_detail */
+
+// FUNCTIONS
+// ---------
+
+/**
+ *  \brief Counters from exited threads and the calling thread.
+ */
+inline
+vector<profile_record>
+profile_snapshot()
+{
+    profile_detail::table counters = profile_detail::local().counters;
+    profile_detail::global_table &g = profile_detail::global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    profile_detail::merge(counters, g.counters);
+    return profile_detail::records(counters);
+}
+
+/**
+ *  \brief Reset the counters of exited threads and the calling thread.
+ */
+inline
+void
+profile_reset()
+{
+    for (auto &item: profile_detail::local().counters) {
+        item.second = profile_detail::counters();
+    }
+    profile_detail::global_table &g = profile_detail::global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    g.counters.clear();
+}
+
+/**
+ *  \brief Write `profile_snapshot` to a stream as text or JSON.
+ */
+inline
+void
+profile_dump(
+    FILE* stream,
+    profile_format format
+)
+{
+    profile_detail::write(stream, format, profile_snapshot());
+}
+
+/**
+ *  \brief Write the counters of all threads to a stream at exit.
+ *
+ *  Only the first call registers the handler, later calls change
+ *  the format and stream.
+ */
+inline
+void
+profile_dump_at_exit(
+    profile_format format,
+    FILE* stream = stderr
+)
+{
+    profile_detail::global_table &g = profile_detail::global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    g.format = format;
+    if (!g.stream) {
+        atexit(profile_detail::dump_at_exit);
+    }
+    g.stream = stream;
+}
+
+PYCPP_END_NAMESPACE
+
+// MACROS
+// ------
+
+#define PYCPP_SFINAE_PROFILE_SCOPE(functor, T, native)                          \
+    PYCPP_NAMESPACE::profile_detail::scope<functor, T> pycpp_profile_scope_(#functor, native)
+
+#endif
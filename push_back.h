@@ -8,13 +8,19 @@
  *
  *  \synopsis
  *      template <typename T>
- *      struct has_push_back: implementation_defined
+ *      using has_push_back = bool_constant<container_traits<T>::has_push_back>;
+ *
+ *      template <typename T>
+ *      struct is_nothrow_push_back: implementation_defined
  *      {};
  *
  *      struct push_back
  *      {
  *          template <typename T>
- *          void operator()(T& t, typename T::const_reference v);
+ *          constexpr void operator()(T& t, typename T::const_reference v) noexcept(is_nothrow_push_back<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr void operator()(allow_fallback_t, T& t, typename T::const_reference v) noexcept(is_nothrow_push_back<T>::value);
  *      };
  *
  *      #if PYCPP_CPP14
@@ -22,46 +28,127 @@
  *      template <typename T>
  *      constexpr bool has_push_back_v = implementation-defined;
  *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_push_back_v = implementation-defined;
+ *
  *      #endif
  */
 
 #pragma once
 
-#include <pycpp/sfinae/has_member_function.h>
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/container_traits.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/profile.h>
 #include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
 
 PYCPP_BEGIN_NAMESPACE
 
+namespace push_back_detail
+{
 // SFINAE
 // ------
 
-PYCPP_HAS_MEMBER_FUNCTION(push_back, has_push_back, void (C::*)(typename C::const_reference));
+template <bool Native, typename T>
+struct is_nothrow: bool_constant<noexcept(declval<T&>().push_back(declval<typename T::const_reference>()))>
+{};
+
+template <typename T>
+struct is_nothrow<false, T>: bool_constant<noexcept(declval<T&>().insert(declval<T&>().end(), declval<typename T::const_reference>()))>
+{};
+
+}   /* push_back_detail */
 
+// SFINAE
+// ------
+
+/**
+ *  Detect a native `push_back`, from `container_traits`.
+ */
+template <typename T>
+using has_push_back = bool_constant<container_traits<T>::has_push_back>;
+
+/**
+ *  Detect if the call selected by `push_back` cannot throw.
+ */
+template <typename T>
+using is_nothrow_push_back = push_back_detail::is_nothrow<container_traits<T>::has_push_back, T>;
 
 /**
  *  \brief Call `push_back` as a functor.
  */
 struct push_back
 {
-    template <typename T>
-    enable_if_t<has_push_back<T>::value, void>
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
     operator()(
         T &t,
         typename T::const_reference v
     )
+    noexcept(is_nothrow_push_back<T>::value)
     {
+        if constexpr (container_traits<T>::has_push_back) {
+            PYCPP_SFINAE_PROFILE_SCOPE(push_back, T, true);
+            t.push_back(v);
+        } else {
+            PYCPP_SFINAE_REQUIRE_COMPLEXITY(push_back, T, AllowFallback);
+            PYCPP_SFINAE_PROFILE_SCOPE(push_back, T, false);
+            t.insert(t.end(), v);
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_push_back, void>
+    operator()(
+        T &t,
+        typename T::const_reference v
+    )
+    noexcept(is_nothrow_push_back<T>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(push_back, T, true);
         t.push_back(v);
     }
 
-    template <typename T>
-    enable_if_t<!has_push_back<T>::value, void>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_push_back, void>
     operator()(
         T &t,
         typename T::const_reference v
     )
+    noexcept(is_nothrow_push_back<T>::value)
     {
+        PYCPP_SFINAE_REQUIRE_COMPLEXITY(push_back, T, AllowFallback);
+        PYCPP_SFINAE_PROFILE_SCOPE(push_back, T, false);
         t.insert(t.end(), v);
     }
+
+#endif
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        allow_fallback_t,
+        T &t,
+        typename T::const_reference v
+    )
+    noexcept(is_nothrow_push_back<T>::value)
+    {
+        this->template operator()<true>(t, v);
+    }
 };
 
 #ifdef PYCPP_CPP14
@@ -70,8 +157,17 @@ struct push_back
 // ------
 
 template <typename T>
-constexpr bool has_push_back_v = has_push_back<T>::value;
+constexpr bool has_push_back_v = container_traits<T>::has_push_back;
+
+template <typename T>
+constexpr bool is_nothrow_push_back_v = is_nothrow_push_back<T>::value;
 
 #endif
 
 PYCPP_END_NAMESPACE
+
+// Strict mode checks the cost of the fallback, from `complexity.h`,
+// unless a batch functor includes it once the batch functor is defined.
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY) && !defined(PYCPP_SFINAE_DETAIL_DEFER_COMPLEXITY)
+#   include <pycpp/sfinae/complexity.h>
+#endif
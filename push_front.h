@@ -8,13 +8,19 @@
  *
  *  \synopsis
  *      template <typename T>
- *      struct has_push_front: implementation_defined
+ *      using has_push_front = bool_constant<container_traits<T>::has_push_front>;
+ *
+ *      template <typename T>
+ *      struct is_nothrow_push_front: implementation_defined
  *      {};
  *
  *      struct push_front
  *      {
  *          template <typename T>
- *          void operator()(T& t, typename T::const_reference v);
+ *          constexpr void operator()(T& t, typename T::const_reference v) noexcept(is_nothrow_push_front<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr void operator()(allow_fallback_t, T& t, typename T::const_reference v) noexcept(is_nothrow_push_front<T>::value);
  *      };
  *
  *      #if PYCPP_CPP14
@@ -22,46 +28,127 @@
  *      template <typename T>
  *      constexpr bool has_push_front_v = implementation-defined;
  *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_push_front_v = implementation-defined;
+ *
  *      #endif
  */
 
 #pragma once
 
-#include <pycpp/sfinae/has_member_function.h>
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/container_traits.h>
+#include <pycpp/sfinae/fallback.h>
+#include <pycpp/sfinae/profile.h>
 #include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
 
 PYCPP_BEGIN_NAMESPACE
 
+namespace push_front_detail
+{
 // SFINAE
 // ------
 
-PYCPP_HAS_MEMBER_FUNCTION(push_front, has_push_front, void (C::*)(typename C::const_reference));
+template <bool Native, typename T>
+struct is_nothrow: bool_constant<noexcept(declval<T&>().push_front(declval<typename T::const_reference>()))>
+{};
+
+template <typename T>
+struct is_nothrow<false, T>: bool_constant<noexcept(declval<T&>().insert(declval<T&>().begin(), declval<typename T::const_reference>()))>
+{};
+
+}   /* push_front_detail */
 
+// SFINAE
+// ------
+
+/**
+ *  Detect a native `push_front`, from `container_traits`.
+ */
+template <typename T>
+using has_push_front = bool_constant<container_traits<T>::has_push_front>;
+
+/**
+ *  Detect if the call selected by `push_front` cannot throw.
+ */
+template <typename T>
+using is_nothrow_push_front = push_front_detail::is_nothrow<container_traits<T>::has_push_front, T>;
 
 /**
  *  \brief Call `push_front` as a functor.
  */
 struct push_front
 {
-    template <typename T>
-    enable_if_t<has_push_front<T>::value, void>
+#if defined(PYCPP_CPP20)
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
     operator()(
         T &t,
         typename T::const_reference v
     )
+    noexcept(is_nothrow_push_front<T>::value)
     {
+        if constexpr (container_traits<T>::has_push_front) {
+            PYCPP_SFINAE_PROFILE_SCOPE(push_front, T, true);
+            t.push_front(v);
+        } else {
+            PYCPP_SFINAE_REQUIRE_COMPLEXITY(push_front, T, AllowFallback);
+            PYCPP_SFINAE_PROFILE_SCOPE(push_front, T, false);
+            t.insert(t.begin(), v);
+        }
+    }
+
+#else
+
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_push_front, void>
+    operator()(
+        T &t,
+        typename T::const_reference v
+    )
+    noexcept(is_nothrow_push_front<T>::value)
+    {
+        PYCPP_SFINAE_PROFILE_SCOPE(push_front, T, true);
         t.push_front(v);
     }
 
-    template <typename T>
-    enable_if_t<!has_push_front<T>::value, void>
+    template <bool AllowFallback = false, typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_push_front, void>
     operator()(
         T &t,
         typename T::const_reference v
     )
+    noexcept(is_nothrow_push_front<T>::value)
     {
+        PYCPP_SFINAE_REQUIRE_COMPLEXITY(push_front, T, AllowFallback);
+        PYCPP_SFINAE_PROFILE_SCOPE(push_front, T, false);
         t.insert(t.begin(), v);
     }
+
+#endif
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        allow_fallback_t,
+        T &t,
+        typename T::const_reference v
+    )
+    noexcept(is_nothrow_push_front<T>::value)
+    {
+        this->template operator()<true>(t, v);
+    }
 };
 
 #ifdef PYCPP_CPP14
@@ -70,8 +157,17 @@ struct push_front
 // ------
 
 template <typename T>
-constexpr bool has_push_front_v = has_push_front<T>::value;
+constexpr bool has_push_front_v = container_traits<T>::has_push_front;
+
+template <typename T>
+constexpr bool is_nothrow_push_front_v = is_nothrow_push_front<T>::value;
 
 #endif
 
 PYCPP_END_NAMESPACE
+
+// Strict mode checks the cost of the fallback, from `complexity.h`,
+// unless a batch functor includes it once the batch functor is defined.
+#if defined(PYCPP_SFINAE_STRICT_COMPLEXITY) && !defined(PYCPP_SFINAE_DETAIL_DEFER_COMPLEXITY)
+#   include <pycpp/sfinae/complexity.h>
+#endif
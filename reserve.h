@@ -4,17 +4,50 @@
  *  \addtogroup PyCPP
  *  \brief SFINAE detection for `reserve` and fail-safe implementation.
  *
- *  Increase container capacity to desired size.
+ *  Increase container capacity to desired size. By default, the
+ *  capacity is increased to exactly the requested size, however,
+ *  a policy may be passed to preserve amortized geometric growth
+ *  (`geometric_reserve_t`), or to request space for additional
+ *  items past the current size (`additional_reserve_t`).
+ *
+ *  Hashed containers without a `reserve` method are grown through
+ *  `rehash`, using `bucket_count` and `max_load_factor` to estimate
+ *  their capacity.
  *
  *  \synopsis
  *      template <typename T>
- *      struct has_reserve: implementation_defined
+ *      using has_reserve = bool_constant<container_traits<T>::has_reserve>;
+ *
+ *      template <typename T>
+ *      using has_capacity = bool_constant<container_traits<T>::has_capacity>;
+ *
+ *      template <typename T>
+ *      using has_rehash = bool_constant<container_traits<T>::has_rehash>;
+ *
+ *      template <typename T>
+ *      using has_bucket_count = bool_constant<container_traits<T>::has_bucket_count>;
+ *
+ *      template <typename T>
+ *      struct is_nothrow_reserve: implementation_defined
  *      {};
  *
+ *      struct exact_reserve_t {};
+ *      struct geometric_reserve_t {};
+ *      struct additional_reserve_t {};
+ *
  *      struct reserve
  *      {
  *          template <typename T>
- *          void operator()(T& t, size_t size);
+ *          constexpr void operator()(T& t, size_t size) noexcept(is_nothrow_reserve<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr void operator()(T& t, size_t size, exact_reserve_t) noexcept(is_nothrow_reserve<T>::value);
+ *
+ *          template <typename T>
+ *          constexpr void operator()(T& t, size_t size, geometric_reserve_t) noexcept(implementation-defined);
+ *
+ *          template <typename T>
+ *          constexpr void operator()(T& t, size_t n, additional_reserve_t) noexcept(implementation-defined);
  *      };
  *
  *      #if PYCPP_CPP14
@@ -22,13 +55,28 @@
  *      template <typename T>
  *      constexpr bool has_reserve_v = implementation-defined;
  *
+ *      template <typename T>
+ *      constexpr bool has_capacity_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool has_rehash_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool has_bucket_count_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_reserve_v = implementation-defined;
+ *
  *      #endif
  */
 
 #pragma once
 
-#include <pycpp/sfinae/has_member_function.h>
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/container_traits.h>
 #include <pycpp/stl/type_traits.h>
+#include <math.h>
 #include <stddef.h>
 
 PYCPP_BEGIN_NAMESPACE
@@ -36,8 +84,259 @@ PYCPP_BEGIN_NAMESPACE
 // SFINAE
 // ------
 
-PYCPP_HAS_MEMBER_FUNCTION(reserve, has_reserve, void (C::*)(typename C::size_type));
+// Detect each method, from `container_traits`.
+
+template <typename T>
+using has_reserve = bool_constant<container_traits<T>::has_reserve>;
+
+template <typename T>
+using has_capacity = bool_constant<container_traits<T>::has_capacity>;
+
+template <typename T>
+using has_rehash = bool_constant<container_traits<T>::has_rehash>;
+
+template <typename T>
+using has_bucket_count = bool_constant<container_traits<T>::has_bucket_count>;
+
+// POLICIES
+// --------
+
+/**
+ *  \brief Reserve exactly the requested number of items.
+ */
+struct exact_reserve_t
+{};
+
+/**
+ *  \brief Reserve at least the requested number of items,
+ *  doubling the current capacity if that is larger.
+ */
+struct geometric_reserve_t
+{};
+
+/**
+ *  \brief Reserve space for `n` items past the current size,
+ *  with geometric growth.
+ */
+struct additional_reserve_t
+{};
+
+namespace reserve_detail
+{
+// SFINAE
+// ------
+
+template <typename T>
+using is_hashed = bool_constant<!container_traits<T>::has_reserve && container_traits<T>::has_rehash && container_traits<T>::has_bucket_count>;
+
+template <typename T>
+using is_reservable = bool_constant<container_traits<T>::has_reserve || is_hashed<T>::value>;
+
+template <typename T, typename = void>
+struct is_nothrow_exact: true_type
+{};
+
+template <typename T>
+struct is_nothrow_exact<T, enable_if_t<container_traits<T>::has_reserve>>: bool_constant<noexcept(declval<T&>().reserve(declval<size_t>()))>
+{};
+
+template <typename T>
+struct is_nothrow_exact<T, enable_if_t<is_hashed<T>::value>>: bool_constant<
+        noexcept(declval<T&>().rehash(declval<size_t>())) &&
+        noexcept(declval<T&>().max_load_factor())
+    >
+{};
+
+template <typename T, typename = void>
+struct is_nothrow_capacity: true_type
+{};
+
+template <typename T>
+struct is_nothrow_capacity<T, enable_if_t<container_traits<T>::has_capacity>>: bool_constant<noexcept(declval<const T&>().capacity())>
+{};
+
+template <typename T>
+struct is_nothrow_capacity<T, enable_if_t<!container_traits<T>::has_capacity && container_traits<T>::has_bucket_count>>: bool_constant<
+        noexcept(declval<const T&>().bucket_count()) &&
+        noexcept(declval<const T&>().max_load_factor())
+    >
+{};
+
+template <typename T>
+using is_nothrow_geometric = bool_constant<is_nothrow_exact<T>::value && is_nothrow_capacity<T>::value>;
+
+// FUNCTIONS
+// ---------
+
+#if defined(PYCPP_CPP20)
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+void
+exact(
+    T &t,
+    size_t size
+)
+noexcept(is_nothrow_exact<T>::value)
+{
+    if constexpr (container_traits<T>::has_reserve) {
+        t.reserve(size);
+    } else if constexpr (is_hashed<T>::value) {
+        t.rehash(static_cast<size_t>(ceil(size / t.max_load_factor())));
+    }
+}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+size_t
+capacity(
+    const T &t
+)
+noexcept(is_nothrow_capacity<T>::value)
+{
+    if constexpr (container_traits<T>::has_capacity) {
+        return t.capacity();
+    } else if constexpr (container_traits<T>::has_bucket_count) {
+        return static_cast<size_t>(t.bucket_count() * t.max_load_factor());
+    } else {
+        return 0;
+    }
+}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+void
+geometric(
+    T &t,
+    size_t size
+)
+noexcept(is_nothrow_geometric<T>::value)
+{
+    if constexpr (is_reservable<T>::value) {
+        size_t current = capacity(t);
+        if (size > current) {
+            exact(t, size > 2 * current ? size : 2 * current);
+        }
+    }
+}
+
+#else
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<container_traits<T>::has_reserve, void>
+exact(
+    T &t,
+    size_t size
+)
+noexcept(is_nothrow_exact<T>::value)
+{
+    t.reserve(size);
+}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<is_hashed<T>::value, void>
+exact(
+    T &t,
+    size_t size
+)
+noexcept(is_nothrow_exact<T>::value)
+{
+    t.rehash(static_cast<size_t>(ceil(size / t.max_load_factor())));
+}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<!is_reservable<T>::value, void>
+exact(
+    T &t,
+    size_t size
+)
+noexcept(is_nothrow_exact<T>::value)
+{}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<container_traits<T>::has_capacity, size_t>
+capacity(
+    const T &t
+)
+noexcept(is_nothrow_capacity<T>::value)
+{
+    return t.capacity();
+}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<!container_traits<T>::has_capacity && container_traits<T>::has_bucket_count, size_t>
+capacity(
+    const T &t
+)
+noexcept(is_nothrow_capacity<T>::value)
+{
+    return static_cast<size_t>(t.bucket_count() * t.max_load_factor());
+}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<!container_traits<T>::has_capacity && !container_traits<T>::has_bucket_count, size_t>
+capacity(
+    const T &t
+)
+noexcept(is_nothrow_capacity<T>::value)
+{
+    return 0;
+}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<is_reservable<T>::value, void>
+geometric(
+    T &t,
+    size_t size
+)
+noexcept(is_nothrow_geometric<T>::value)
+{
+    size_t current = capacity(t);
+    if (size > current) {
+        exact(t, size > 2 * current ? size : 2 * current);
+    }
+}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<!is_reservable<T>::value, void>
+geometric(
+    T &t,
+    size_t size
+)
+noexcept(is_nothrow_geometric<T>::value)
+{}
+
+#endif
 
+}   /* reserve_detail */
+
+// SFINAE
+// ------
+
+/**
+ *  Detect if the call selected by `reserve` cannot throw.
+ */
+template <typename T>
+using is_nothrow_reserve = reserve_detail::is_nothrow_exact<T>;
 
 /**
  *  \brief Call `reserve` as a functor.
@@ -45,22 +344,59 @@ PYCPP_HAS_MEMBER_FUNCTION(reserve, has_reserve, void (C::*)(typename C::size_typ
 struct reserve
 {
     template <typename T>
-    enable_if_t<has_reserve<T>::value, void>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
     operator()(
         T &t,
         size_t size
     )
+    noexcept(is_nothrow_reserve<T>::value)
     {
-        t.reserve(size);
+        reserve_detail::exact(t, size);
     }
 
     template <typename T>
-    enable_if_t<!has_reserve<T>::value, void>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
     operator()(
         T &t,
-        size_t size
+        size_t size,
+        exact_reserve_t
+    )
+    noexcept(is_nothrow_reserve<T>::value)
+    {
+        reserve_detail::exact(t, size);
+    }
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t,
+        size_t size,
+        geometric_reserve_t
     )
-    {}
+    noexcept(reserve_detail::is_nothrow_geometric<T>::value)
+    {
+        reserve_detail::geometric(t, size);
+    }
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t,
+        size_t n,
+        additional_reserve_t
+    )
+    noexcept(reserve_detail::is_nothrow_geometric<T>::value)
+    {
+        reserve_detail::geometric(t, t.size() + n);
+    }
 };
 
 #ifdef PYCPP_CPP14
@@ -69,7 +405,19 @@ struct reserve
 // ------
 
 template <typename T>
-constexpr bool has_reserve_v = has_reserve<T>::value;
+constexpr bool has_reserve_v = container_traits<T>::has_reserve;
+
+template <typename T>
+constexpr bool has_capacity_v = container_traits<T>::has_capacity;
+
+template <typename T>
+constexpr bool has_rehash_v = container_traits<T>::has_rehash;
+
+template <typename T>
+constexpr bool has_bucket_count_v = container_traits<T>::has_bucket_count;
+
+template <typename T>
+constexpr bool is_nothrow_reserve_v = is_nothrow_reserve<T>::value;
 
 #endif
 
@@ -0,0 +1,456 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief SFINAE detection for uninitialized resizing and fail-safe implementation.
+ *
+ *  Resize a container without value-initializing the new items, for
+ *  buffers that are immediately overwritten, for example, by a read
+ *  from a socket. The contents of new items are unspecified.
+ *
+ *  `resize_uninitialized()(t, n)` uses, in order of preference, the
+ *  libc++ extension `__resize_default_init` and a custom
+ *  `resize_default_init` method, before falling back to `resize`.
+ *  `std::vector` has neither, so it always takes the value-initializing
+ *  `resize` fallback, as does `std::string` with libstdc++.
+ *
+ *  `resize_uninitialized()(t, n, writer)` also writes the new contents,
+ *  calling `writer(p, n)` once with a pointer to the first item. The
+ *  writer overwrites any of the `n` items, and returns how many to
+ *  keep, at most `n`, and must not throw. The call is forwarded to
+ *  `resize_and_overwrite` (C++23) or the libstdc++ extension
+ *  `__resize_and_overwrite` when available. Otherwise, the container
+ *  is resized as above, the writer is called on `data()`, and the
+ *  container is resized to the returned size.
+ *
+ *  \synopsis
+ *      template <typename T>
+ *      struct has_resize_and_overwrite: implementation_defined
+ *      {};
+ *
+ *      template <typename T>
+ *      struct has_resize_default_init: implementation_defined
+ *      {};
+ *
+ *      template <typename T>
+ *      struct is_nothrow_resize_uninitialized: implementation_defined
+ *      {};
+ *
+ *      struct resize_uninitialized
+ *      {
+ *          template <typename T>
+ *          constexpr void operator()(T& t, size_t size) const noexcept(is_nothrow_resize_uninitialized<T>::value);
+ *
+ *          template <typename T, typename Writer>
+ *          constexpr void operator()(T& t, size_t size, Writer writer) const noexcept(implementation-defined);
+ *      };
+ *
+ *      #if PYCPP_CPP20
+ *
+ *      template <typename T>
+ *      concept supports_resize_and_overwrite = implementation-defined;
+ *
+ *      template <typename T>
+ *      concept supports_resize_default_init = implementation-defined;
+ *
+ *      #endif
+ *
+ *      #if PYCPP_CPP14
+ *
+ *      template <typename T>
+ *      constexpr bool has_resize_and_overwrite_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool has_resize_default_init_v = implementation-defined;
+ *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_resize_uninitialized_v = implementation-defined;
+ *
+ *      #endif
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
+#include <stddef.h>
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace resize_detail
+{
+// OBJECTS
+// -------
+
+/**
+ *  Writer used only to detect `resize_and_overwrite`, never called.
+ */
+struct probe_writer
+{
+    template <typename Pointer, typename Size>
+    Size
+    operator()(
+        Pointer,
+        Size size
+    )
+    const noexcept;
+};
+
+}   /* resize_detail */
+
+// SFINAE
+// ------
+
+#if defined(PYCPP_CPP20)
+
+/**
+ *  Detect `t.resize_and_overwrite(n, op)`.
+ */
+template <typename T>
+concept supports_resize_and_overwrite = requires(T& t, typename T::size_type n) {
+    t.resize_and_overwrite(n, resize_detail::probe_writer());
+};
+
+template <typename T>
+using has_resize_and_overwrite = bool_constant<supports_resize_and_overwrite<T>>;
+
+/**
+ *  Detect `t.resize_default_init(n)`.
+ */
+template <typename T>
+concept supports_resize_default_init = requires(T& t, typename T::size_type n) {
+    t.resize_default_init(n);
+};
+
+template <typename T>
+using has_resize_default_init = bool_constant<supports_resize_default_init<T>>;
+
+#else
+
+/**
+ *  Detect `t.resize_and_overwrite(n, op)`.
+ */
+template <typename T, typename = void>
+struct has_resize_and_overwrite_impl: false_type
+{};
+
+template <typename T>
+struct has_resize_and_overwrite_impl<T, void_t<decltype(declval<T&>().resize_and_overwrite(declval<typename T::size_type>(), resize_detail::probe_writer()))>>: true_type
+{};
+
+template <typename T>
+using has_resize_and_overwrite = has_resize_and_overwrite_impl<T>;
+
+/**
+ *  Detect `t.resize_default_init(n)`.
+ */
+template <typename T, typename = void>
+struct has_resize_default_init_impl: false_type
+{};
+
+template <typename T>
+struct has_resize_default_init_impl<T, void_t<decltype(declval<T&>().resize_default_init(declval<typename T::size_type>()))>>: true_type
+{};
+
+template <typename T>
+using has_resize_default_init = has_resize_default_init_impl<T>;
+
+#endif
+
+namespace resize_detail
+{
+// SFINAE
+// ------
+
+/**
+ *  Detect the libstdc++ extension `t.__resize_and_overwrite(n, op)`.
+ */
+template <typename T, typename = void>
+struct has_gnu_resize_and_overwrite: false_type
+{};
+
+template <typename T>
+struct has_gnu_resize_and_overwrite<T, void_t<decltype(declval<T&>().__resize_and_overwrite(declval<typename T::size_type>(), probe_writer()))>>: true_type
+{};
+
+/**
+ *  Detect the libc++ extension `t.__resize_default_init(n)`.
+ */
+template <typename T, typename = void>
+struct has_libcxx_resize_default_init: false_type
+{};
+
+template <typename T>
+struct has_libcxx_resize_default_init<T, void_t<decltype(declval<T&>().__resize_default_init(declval<typename T::size_type>()))>>: true_type
+{};
+
+template <typename T>
+using use_libcxx_resize_default_init = has_libcxx_resize_default_init<T>;
+
+template <typename T>
+using use_resize_default_init = bool_constant<
+    !use_libcxx_resize_default_init<T>::value &&
+    has_resize_default_init<T>::value
+>;
+
+template <typename T>
+using use_resize = bool_constant<
+    !use_libcxx_resize_default_init<T>::value &&
+    !use_resize_default_init<T>::value
+>;
+
+template <typename T>
+using use_resize_and_overwrite = has_resize_and_overwrite<T>;
+
+template <typename T>
+using use_gnu_resize_and_overwrite = bool_constant<
+    !use_resize_and_overwrite<T>::value &&
+    has_gnu_resize_and_overwrite<T>::value
+>;
+
+template <typename T>
+using use_data_write = bool_constant<
+    !use_resize_and_overwrite<T>::value &&
+    !use_gnu_resize_and_overwrite<T>::value
+>;
+
+template <typename T, typename = void>
+struct is_nothrow: bool_constant<noexcept(declval<T&>().resize(declval<size_t>()))>
+{};
+
+template <typename T>
+struct is_nothrow<T, enable_if_t<use_libcxx_resize_default_init<T>::value>>: bool_constant<noexcept(declval<T&>().__resize_default_init(declval<size_t>()))>
+{};
+
+template <typename T>
+struct is_nothrow<T, enable_if_t<use_resize_default_init<T>::value>>: bool_constant<noexcept(declval<T&>().resize_default_init(declval<size_t>()))>
+{};
+
+/**
+ *  Get a mutable pointer to the items, since `basic_string::data()`
+ *  is const before C++17.
+ */
+template <typename T, typename = void>
+struct has_mutable_data: false_type
+{};
+
+template <typename T>
+struct has_mutable_data<T, enable_if_t<!is_const<remove_pointer_t<decltype(declval<T&>().data())>>::value>>: true_type
+{};
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<has_mutable_data<T>::value, decltype(declval<T&>().data())>
+mutable_data(
+    T &t
+)
+noexcept
+{
+    return t.data();
+}
+
+template <typename T>
+PYCPP_SFINAE_INLINE
+PYCPP_SFINAE_CONSTEXPR
+enable_if_t<!has_mutable_data<T>::value, decltype(&declval<T&>()[0])>
+mutable_data(
+    T &t
+)
+noexcept
+{
+    return &t[0];
+}
+
+/**
+ *  Detect if the call selected with a writer cannot throw.
+ */
+template <typename T, typename Writer, typename = void>
+struct is_nothrow_write: bool_constant<
+    is_nothrow<T>::value &&
+    noexcept(declval<T&>().resize(declval<size_t>())) &&
+    noexcept(declval<Writer&>()(mutable_data(declval<T&>()), declval<size_t>()))
+>
+{};
+
+template <typename T, typename Writer>
+struct is_nothrow_write<T, Writer, enable_if_t<use_resize_and_overwrite<T>::value>>: bool_constant<noexcept(declval<T&>().resize_and_overwrite(declval<size_t>(), declval<Writer>()))>
+{};
+
+template <typename T, typename Writer>
+struct is_nothrow_write<T, Writer, enable_if_t<use_gnu_resize_and_overwrite<T>::value>>: bool_constant<noexcept(declval<T&>().__resize_and_overwrite(declval<size_t>(), declval<Writer>()))>
+{};
+
+}   /* resize_detail */
+
+// SFINAE
+// ------
+
+/**
+ *  Detect if the call selected by `resize_uninitialized` cannot throw.
+ */
+template <typename T>
+using is_nothrow_resize_uninitialized = resize_detail::is_nothrow<T>;
+
+
+/**
+ *  \brief Resize without initializing new items as a functor.
+ */
+struct resize_uninitialized
+{
+#if defined(PYCPP_CPP20)
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t,
+        size_t size
+    )
+    const
+    noexcept(is_nothrow_resize_uninitialized<T>::value)
+    {
+        if constexpr (resize_detail::use_libcxx_resize_default_init<T>::value) {
+            t.__resize_default_init(size);
+        } else if constexpr (resize_detail::use_resize_default_init<T>::value) {
+            t.resize_default_init(size);
+        } else {
+            t.resize(size);
+        }
+    }
+
+    template <typename T, typename Writer>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t,
+        size_t size,
+        Writer writer
+    )
+    const
+    noexcept(resize_detail::is_nothrow_write<T, Writer>::value)
+    {
+        if constexpr (resize_detail::use_resize_and_overwrite<T>::value) {
+            t.resize_and_overwrite(size, move(writer));
+        } else if constexpr (resize_detail::use_gnu_resize_and_overwrite<T>::value) {
+            t.__resize_and_overwrite(size, move(writer));
+        } else {
+            (*this)(t, size);
+            t.resize(static_cast<size_t>(writer(resize_detail::mutable_data(t), size)));
+        }
+    }
+
+#else
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<resize_detail::use_libcxx_resize_default_init<T>::value, void>
+    operator()(
+        T &t,
+        size_t size
+    )
+    const
+    noexcept(is_nothrow_resize_uninitialized<T>::value)
+    {
+        t.__resize_default_init(size);
+    }
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<resize_detail::use_resize_default_init<T>::value, void>
+    operator()(
+        T &t,
+        size_t size
+    )
+    const
+    noexcept(is_nothrow_resize_uninitialized<T>::value)
+    {
+        t.resize_default_init(size);
+    }
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<resize_detail::use_resize<T>::value, void>
+    operator()(
+        T &t,
+        size_t size
+    )
+    const
+    noexcept(is_nothrow_resize_uninitialized<T>::value)
+    {
+        t.resize(size);
+    }
+
+    template <typename T, typename Writer>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<resize_detail::use_resize_and_overwrite<T>::value, void>
+    operator()(
+        T &t,
+        size_t size,
+        Writer writer
+    )
+    const
+    noexcept(resize_detail::is_nothrow_write<T, Writer>::value)
+    {
+        t.resize_and_overwrite(size, move(writer));
+    }
+
+    template <typename T, typename Writer>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<resize_detail::use_gnu_resize_and_overwrite<T>::value, void>
+    operator()(
+        T &t,
+        size_t size,
+        Writer writer
+    )
+    const
+    noexcept(resize_detail::is_nothrow_write<T, Writer>::value)
+    {
+        t.__resize_and_overwrite(size, move(writer));
+    }
+
+    template <typename T, typename Writer>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<resize_detail::use_data_write<T>::value, void>
+    operator()(
+        T &t,
+        size_t size,
+        Writer writer
+    )
+    const
+    noexcept(resize_detail::is_nothrow_write<T, Writer>::value)
+    {
+        (*this)(t, size);
+        t.resize(static_cast<size_t>(writer(resize_detail::mutable_data(t), size)));
+    }
+
+#endif
+};
+
+#ifdef PYCPP_CPP14
+
+// SFINAE
+// ------
+
+template <typename T>
+constexpr bool has_resize_and_overwrite_v = has_resize_and_overwrite<T>::value;
+
+template <typename T>
+constexpr bool has_resize_default_init_v = has_resize_default_init<T>::value;
+
+template <typename T>
+constexpr bool is_nothrow_resize_uninitialized_v = is_nothrow_resize_uninitialized<T>::value;
+
+#endif
+
+PYCPP_END_NAMESPACE
@@ -0,0 +1,344 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief SFINAE utilities as a C++20 named module.
+ *
+ *  Exports every trait, `_v` variable template, concept, and functor
+ *  from `module.h.in` as `pycpp.sfinae`. Macros cannot be exported
+ *  from a module: code defining its own detectors with
+ *  `PYCPP_HAS_OPERATION` or `PYCPP_HAS_MEMBER_FUNCTION` must still
+ *  include the corresponding header.
+ */
+
+module;
+
+#include <pycpp/sfinae/functors.h>
+#include <pycpp/sfinae/members.h>
+#include <pycpp/sfinae/operators.h>
+#include <pycpp/sfinae/types.h>
+
+export module pycpp.sfinae;
+
+export namespace PYCPP_NAMESPACE
+{
+// OPERATORS
+// ---------
+
+using PYCPP_NAMESPACE::decl_lvalue;
+using PYCPP_NAMESPACE::has_bit_and;
+using PYCPP_NAMESPACE::has_bit_and_v;
+using PYCPP_NAMESPACE::supports_bit_and;
+using PYCPP_NAMESPACE::has_bit_and_assign;
+using PYCPP_NAMESPACE::has_bit_and_assign_v;
+using PYCPP_NAMESPACE::supports_bit_and_assign;
+using PYCPP_NAMESPACE::has_bit_or;
+using PYCPP_NAMESPACE::has_bit_or_v;
+using PYCPP_NAMESPACE::supports_bit_or;
+using PYCPP_NAMESPACE::has_bit_or_assign;
+using PYCPP_NAMESPACE::has_bit_or_assign_v;
+using PYCPP_NAMESPACE::supports_bit_or_assign;
+using PYCPP_NAMESPACE::has_bit_xor;
+using PYCPP_NAMESPACE::has_bit_xor_v;
+using PYCPP_NAMESPACE::supports_bit_xor;
+using PYCPP_NAMESPACE::has_bit_xor_assign;
+using PYCPP_NAMESPACE::has_bit_xor_assign_v;
+using PYCPP_NAMESPACE::supports_bit_xor_assign;
+using PYCPP_NAMESPACE::has_divides;
+using PYCPP_NAMESPACE::has_divides_v;
+using PYCPP_NAMESPACE::supports_divides;
+using PYCPP_NAMESPACE::has_divides_assign;
+using PYCPP_NAMESPACE::has_divides_assign_v;
+using PYCPP_NAMESPACE::supports_divides_assign;
+using PYCPP_NAMESPACE::has_equal_to;
+using PYCPP_NAMESPACE::has_equal_to_v;
+using PYCPP_NAMESPACE::supports_equal_to;
+using PYCPP_NAMESPACE::has_greater;
+using PYCPP_NAMESPACE::has_greater_v;
+using PYCPP_NAMESPACE::supports_greater;
+using PYCPP_NAMESPACE::has_greater_equal;
+using PYCPP_NAMESPACE::has_greater_equal_v;
+using PYCPP_NAMESPACE::supports_greater_equal;
+using PYCPP_NAMESPACE::has_left_shift;
+using PYCPP_NAMESPACE::has_left_shift_v;
+using PYCPP_NAMESPACE::supports_left_shift;
+using PYCPP_NAMESPACE::has_left_shift_assign;
+using PYCPP_NAMESPACE::has_left_shift_assign_v;
+using PYCPP_NAMESPACE::supports_left_shift_assign;
+using PYCPP_NAMESPACE::has_less;
+using PYCPP_NAMESPACE::has_less_v;
+using PYCPP_NAMESPACE::supports_less;
+using PYCPP_NAMESPACE::has_less_equal;
+using PYCPP_NAMESPACE::has_less_equal_v;
+using PYCPP_NAMESPACE::supports_less_equal;
+using PYCPP_NAMESPACE::has_logical_and;
+using PYCPP_NAMESPACE::has_logical_and_v;
+using PYCPP_NAMESPACE::supports_logical_and;
+using PYCPP_NAMESPACE::has_logical_or;
+using PYCPP_NAMESPACE::has_logical_or_v;
+using PYCPP_NAMESPACE::supports_logical_or;
+using PYCPP_NAMESPACE::has_minus;
+using PYCPP_NAMESPACE::has_minus_v;
+using PYCPP_NAMESPACE::supports_minus;
+using PYCPP_NAMESPACE::has_minus_assign;
+using PYCPP_NAMESPACE::has_minus_assign_v;
+using PYCPP_NAMESPACE::supports_minus_assign;
+using PYCPP_NAMESPACE::has_modulus;
+using PYCPP_NAMESPACE::has_modulus_v;
+using PYCPP_NAMESPACE::supports_modulus;
+using PYCPP_NAMESPACE::has_modulus_assign;
+using PYCPP_NAMESPACE::has_modulus_assign_v;
+using PYCPP_NAMESPACE::supports_modulus_assign;
+using PYCPP_NAMESPACE::has_multiplies;
+using PYCPP_NAMESPACE::has_multiplies_v;
+using PYCPP_NAMESPACE::supports_multiplies;
+using PYCPP_NAMESPACE::has_multiplies_assign;
+using PYCPP_NAMESPACE::has_multiplies_assign_v;
+using PYCPP_NAMESPACE::supports_multiplies_assign;
+using PYCPP_NAMESPACE::has_not_equal_to;
+using PYCPP_NAMESPACE::has_not_equal_to_v;
+using PYCPP_NAMESPACE::supports_not_equal_to;
+using PYCPP_NAMESPACE::has_plus;
+using PYCPP_NAMESPACE::has_plus_v;
+using PYCPP_NAMESPACE::supports_plus;
+using PYCPP_NAMESPACE::has_plus_assign;
+using PYCPP_NAMESPACE::has_plus_assign_v;
+using PYCPP_NAMESPACE::supports_plus_assign;
+using PYCPP_NAMESPACE::has_right_shift;
+using PYCPP_NAMESPACE::has_right_shift_v;
+using PYCPP_NAMESPACE::supports_right_shift;
+using PYCPP_NAMESPACE::has_right_shift_assign;
+using PYCPP_NAMESPACE::has_right_shift_assign_v;
+using PYCPP_NAMESPACE::supports_right_shift_assign;
+using PYCPP_NAMESPACE::has_subscript;
+using PYCPP_NAMESPACE::has_subscript_v;
+using PYCPP_NAMESPACE::supports_subscript;
+
+// TYPES
+// -----
+
+using PYCPP_NAMESPACE::is_complex;
+using PYCPP_NAMESPACE::is_complex_v;
+using PYCPP_NAMESPACE::is_pair;
+using PYCPP_NAMESPACE::is_pair_v;
+using PYCPP_NAMESPACE::is_specialization;
+using PYCPP_NAMESPACE::is_specialization_v;
+using PYCPP_NAMESPACE::is_tuple;
+using PYCPP_NAMESPACE::is_tuple_v;
+using PYCPP_NAMESPACE::is_reference_wrapper;
+using PYCPP_NAMESPACE::is_charp;
+using PYCPP_NAMESPACE::is_charp_v;
+using PYCPP_NAMESPACE::is_const_charp;
+using PYCPP_NAMESPACE::is_const_charp_v;
+using PYCPP_NAMESPACE::is_wcharp;
+using PYCPP_NAMESPACE::is_wcharp_v;
+using PYCPP_NAMESPACE::is_const_wcharp;
+using PYCPP_NAMESPACE::is_const_wcharp_v;
+using PYCPP_NAMESPACE::is_char16p;
+using PYCPP_NAMESPACE::is_char16p_v;
+using PYCPP_NAMESPACE::is_const_char16p;
+using PYCPP_NAMESPACE::is_const_char16p_v;
+using PYCPP_NAMESPACE::is_char32p;
+using PYCPP_NAMESPACE::is_char32p_v;
+using PYCPP_NAMESPACE::is_const_char32p;
+using PYCPP_NAMESPACE::is_const_char32p_v;
+using PYCPP_NAMESPACE::is_stl_string;
+using PYCPP_NAMESPACE::is_stl_string_v;
+using PYCPP_NAMESPACE::is_char_array;
+using PYCPP_NAMESPACE::is_char_array_v;
+using PYCPP_NAMESPACE::string_extent;
+using PYCPP_NAMESPACE::string_extent_v;
+using PYCPP_NAMESPACE::string_literal_t;
+using PYCPP_NAMESPACE::string_size;
+using PYCPP_NAMESPACE::is_string;
+using PYCPP_NAMESPACE::is_string_v;
+using PYCPP_NAMESPACE::is_trivially_relocatable;
+using PYCPP_NAMESPACE::is_trivially_relocatable_v;
+using PYCPP_NAMESPACE::relocate;
+using PYCPP_NAMESPACE::is_contiguous_container;
+using PYCPP_NAMESPACE::is_contiguous_container_v;
+using PYCPP_NAMESPACE::contiguous_element_t;
+using PYCPP_NAMESPACE::contiguous_span;
+using PYCPP_NAMESPACE::as_span;
+using PYCPP_NAMESPACE::is_complex_like;
+using PYCPP_NAMESPACE::is_complex_like_v;
+using PYCPP_NAMESPACE::is_interleaved_complex;
+using PYCPP_NAMESPACE::is_interleaved_complex_v;
+using PYCPP_NAMESPACE::complex_value_t;
+using PYCPP_NAMESPACE::is_string_view;
+using PYCPP_NAMESPACE::is_string_view_v;
+using PYCPP_NAMESPACE::is_string_like;
+using PYCPP_NAMESPACE::is_string_like_v;
+using PYCPP_NAMESPACE::string_char_t;
+using PYCPP_NAMESPACE::string_view_t;
+using PYCPP_NAMESPACE::as_string_view;
+
+// FUNCTORS
+// --------
+
+using PYCPP_NAMESPACE::back;
+using PYCPP_NAMESPACE::has_back;
+using PYCPP_NAMESPACE::has_back_v;
+using PYCPP_NAMESPACE::emplace_back;
+using PYCPP_NAMESPACE::has_emplace_back;
+using PYCPP_NAMESPACE::has_emplace_back_v;
+using PYCPP_NAMESPACE::emplace_front;
+using PYCPP_NAMESPACE::has_emplace_front;
+using PYCPP_NAMESPACE::has_emplace_front_v;
+using PYCPP_NAMESPACE::front;
+using PYCPP_NAMESPACE::has_front;
+using PYCPP_NAMESPACE::has_front_v;
+using PYCPP_NAMESPACE::pop_back;
+using PYCPP_NAMESPACE::has_pop_back;
+using PYCPP_NAMESPACE::has_pop_back_v;
+using PYCPP_NAMESPACE::pop_front;
+using PYCPP_NAMESPACE::has_pop_front;
+using PYCPP_NAMESPACE::has_pop_front_v;
+using PYCPP_NAMESPACE::push_back;
+using PYCPP_NAMESPACE::has_push_back;
+using PYCPP_NAMESPACE::has_push_back_v;
+using PYCPP_NAMESPACE::push_front;
+using PYCPP_NAMESPACE::has_push_front;
+using PYCPP_NAMESPACE::has_push_front_v;
+using PYCPP_NAMESPACE::shrink_to_fit;
+using PYCPP_NAMESPACE::has_shrink_to_fit;
+using PYCPP_NAMESPACE::has_shrink_to_fit_v;
+using PYCPP_NAMESPACE::reserve;
+using PYCPP_NAMESPACE::has_reserve;
+using PYCPP_NAMESPACE::has_reserve_v;
+using PYCPP_NAMESPACE::has_capacity;
+using PYCPP_NAMESPACE::has_capacity_v;
+using PYCPP_NAMESPACE::has_rehash;
+using PYCPP_NAMESPACE::has_rehash_v;
+using PYCPP_NAMESPACE::has_bucket_count;
+using PYCPP_NAMESPACE::has_bucket_count_v;
+using PYCPP_NAMESPACE::exact_reserve_t;
+using PYCPP_NAMESPACE::geometric_reserve_t;
+using PYCPP_NAMESPACE::additional_reserve_t;
+using PYCPP_NAMESPACE::extend;
+using PYCPP_NAMESPACE::has_append;
+using PYCPP_NAMESPACE::has_append_v;
+using PYCPP_NAMESPACE::supports_append;
+using PYCPP_NAMESPACE::has_range_insert;
+using PYCPP_NAMESPACE::has_range_insert_v;
+using PYCPP_NAMESPACE::supports_range_insert;
+using PYCPP_NAMESPACE::has_unpositioned_range_insert;
+using PYCPP_NAMESPACE::has_unpositioned_range_insert_v;
+using PYCPP_NAMESPACE::supports_unpositioned_range_insert;
+using PYCPP_NAMESPACE::pop_front_n;
+using PYCPP_NAMESPACE::pop_back_n;
+using PYCPP_NAMESPACE::has_range_erase;
+using PYCPP_NAMESPACE::has_range_erase_v;
+using PYCPP_NAMESPACE::supports_range_erase;
+using PYCPP_NAMESPACE::has_resize;
+using PYCPP_NAMESPACE::has_resize_v;
+using PYCPP_NAMESPACE::supports_resize;
+using PYCPP_NAMESPACE::container_traits;
+using PYCPP_NAMESPACE::container_capabilities_v;
+using PYCPP_NAMESPACE::container_capability;
+using PYCPP_NAMESPACE::container_back;
+using PYCPP_NAMESPACE::container_front;
+using PYCPP_NAMESPACE::container_push_back;
+using PYCPP_NAMESPACE::container_push_front;
+using PYCPP_NAMESPACE::container_pop_back;
+using PYCPP_NAMESPACE::container_pop_front;
+using PYCPP_NAMESPACE::container_emplace_back;
+using PYCPP_NAMESPACE::container_emplace_front;
+using PYCPP_NAMESPACE::container_reserve;
+using PYCPP_NAMESPACE::container_shrink_to_fit;
+using PYCPP_NAMESPACE::container_subscript;
+using PYCPP_NAMESPACE::container_contiguous;
+using PYCPP_NAMESPACE::container_capacity;
+using PYCPP_NAMESPACE::container_rehash;
+using PYCPP_NAMESPACE::container_bucket_count;
+using PYCPP_NAMESPACE::supports_back;
+using PYCPP_NAMESPACE::supports_front;
+using PYCPP_NAMESPACE::supports_push_back;
+using PYCPP_NAMESPACE::supports_push_front;
+using PYCPP_NAMESPACE::supports_pop_back;
+using PYCPP_NAMESPACE::supports_pop_front;
+using PYCPP_NAMESPACE::supports_emplace_back;
+using PYCPP_NAMESPACE::supports_emplace_front;
+using PYCPP_NAMESPACE::supports_reserve;
+using PYCPP_NAMESPACE::supports_capacity;
+using PYCPP_NAMESPACE::supports_rehash;
+using PYCPP_NAMESPACE::supports_bucket_count;
+using PYCPP_NAMESPACE::supports_shrink_to_fit;
+using PYCPP_NAMESPACE::has_data;
+using PYCPP_NAMESPACE::has_data_v;
+using PYCPP_NAMESPACE::add_to;
+using PYCPP_NAMESPACE::sub_to;
+using PYCPP_NAMESPACE::mul_to;
+using PYCPP_NAMESPACE::div_to;
+using PYCPP_NAMESPACE::mod_to;
+using PYCPP_NAMESPACE::and_to;
+using PYCPP_NAMESPACE::or_to;
+using PYCPP_NAMESPACE::xor_to;
+using PYCPP_NAMESPACE::shl_to;
+using PYCPP_NAMESPACE::shr_to;
+using PYCPP_NAMESPACE::elementwise_plus;
+using PYCPP_NAMESPACE::elementwise_minus;
+using PYCPP_NAMESPACE::elementwise_multiplies;
+using PYCPP_NAMESPACE::elementwise_divides;
+using PYCPP_NAMESPACE::elementwise_bit_and;
+using PYCPP_NAMESPACE::elementwise_bit_or;
+using PYCPP_NAMESPACE::elementwise_bit_xor;
+using PYCPP_NAMESPACE::elementwise_left_shift;
+using PYCPP_NAMESPACE::elementwise_right_shift;
+using PYCPP_NAMESPACE::fast_complex_t;
+using PYCPP_NAMESPACE::complex_multiply;
+using PYCPP_NAMESPACE::complex_multiply_accumulate;
+using PYCPP_NAMESPACE::complex_conj_multiply;
+using PYCPP_NAMESPACE::complex_magnitude;
+using PYCPP_NAMESPACE::concat;
+using PYCPP_NAMESPACE::join;
+using PYCPP_NAMESPACE::resize_uninitialized;
+using PYCPP_NAMESPACE::has_resize_and_overwrite;
+using PYCPP_NAMESPACE::has_resize_and_overwrite_v;
+using PYCPP_NAMESPACE::supports_resize_and_overwrite;
+using PYCPP_NAMESPACE::has_resize_default_init;
+using PYCPP_NAMESPACE::has_resize_default_init_v;
+using PYCPP_NAMESPACE::supports_resize_default_init;
+using PYCPP_NAMESPACE::is_nothrow_back;
+using PYCPP_NAMESPACE::is_nothrow_back_v;
+using PYCPP_NAMESPACE::is_nothrow_front;
+using PYCPP_NAMESPACE::is_nothrow_front_v;
+using PYCPP_NAMESPACE::is_nothrow_push_back;
+using PYCPP_NAMESPACE::is_nothrow_push_back_v;
+using PYCPP_NAMESPACE::is_nothrow_push_front;
+using PYCPP_NAMESPACE::is_nothrow_push_front_v;
+using PYCPP_NAMESPACE::is_nothrow_emplace_back;
+using PYCPP_NAMESPACE::is_nothrow_emplace_back_v;
+using PYCPP_NAMESPACE::is_nothrow_emplace_front;
+using PYCPP_NAMESPACE::is_nothrow_emplace_front_v;
+using PYCPP_NAMESPACE::is_nothrow_pop_back;
+using PYCPP_NAMESPACE::is_nothrow_pop_back_v;
+using PYCPP_NAMESPACE::is_nothrow_pop_front;
+using PYCPP_NAMESPACE::is_nothrow_pop_front_v;
+using PYCPP_NAMESPACE::is_nothrow_pop_front_n;
+using PYCPP_NAMESPACE::is_nothrow_pop_front_n_v;
+using PYCPP_NAMESPACE::is_nothrow_pop_back_n;
+using PYCPP_NAMESPACE::is_nothrow_pop_back_n_v;
+using PYCPP_NAMESPACE::is_nothrow_reserve;
+using PYCPP_NAMESPACE::is_nothrow_reserve_v;
+using PYCPP_NAMESPACE::is_nothrow_shrink_to_fit;
+using PYCPP_NAMESPACE::is_nothrow_shrink_to_fit_v;
+using PYCPP_NAMESPACE::is_nothrow_resize_uninitialized;
+using PYCPP_NAMESPACE::is_nothrow_resize_uninitialized_v;
+using PYCPP_NAMESPACE::is_nothrow_extend;
+using PYCPP_NAMESPACE::is_nothrow_extend_v;
+using PYCPP_NAMESPACE::complexity;
+using PYCPP_NAMESPACE::complexity_v;
+using PYCPP_NAMESPACE::complexity_class;
+using PYCPP_NAMESPACE::allow_fallback_t;
+
+#if defined(PYCPP_SFINAE_PROFILE)
+using PYCPP_NAMESPACE::profile_format;
+using PYCPP_NAMESPACE::profile_record;
+using PYCPP_NAMESPACE::profile_snapshot;
+using PYCPP_NAMESPACE::profile_reset;
+using PYCPP_NAMESPACE::profile_dump;
+using PYCPP_NAMESPACE::profile_dump_at_exit;
+#endif
+
+}   /* PYCPP_NAMESPACE */
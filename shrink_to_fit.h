@@ -8,13 +8,16 @@
  *
  *  \synopsis
  *      template <typename T>
- *      struct has_shrink_to_fit: implementation_defined
+ *      using has_shrink_to_fit = bool_constant<container_traits<T>::has_shrink_to_fit>;
+ *
+ *      template <typename T>
+ *      struct is_nothrow_shrink_to_fit: implementation_defined
  *      {};
  *
  *      struct shrink_to_fit
  *      {
  *          template <typename T>
- *          void operator()(T& t);
+ *          constexpr void operator()(T& t) noexcept(is_nothrow_shrink_to_fit<T>::value);
  *      };
  *
  *      #if PYCPP_CPP14
@@ -22,43 +25,99 @@
  *      template <typename T>
  *      constexpr bool has_shrink_to_fit_v = implementation-defined;
  *
+ *      template <typename T>
+ *      constexpr bool is_nothrow_shrink_to_fit_v = implementation-defined;
+ *
  *      #endif
  */
 
 #pragma once
 
-#include <pycpp/sfinae/has_member_function.h>
+#include <pycpp/preprocessor/compiler.h>
+#include <pycpp/sfinae/attributes.h>
+#include <pycpp/sfinae/container_traits.h>
 #include <pycpp/stl/type_traits.h>
+#include <pycpp/stl/utility.h>
 
 PYCPP_BEGIN_NAMESPACE
 
+namespace shrink_to_fit_detail
+{
 // SFINAE
 // ------
 
-PYCPP_HAS_MEMBER_FUNCTION(shrink_to_fit, has_shrink_to_fit, void (C::*)());
+template <bool Native, typename T>
+struct is_nothrow: bool_constant<noexcept(declval<T&>().shrink_to_fit())>
+{};
+
+template <typename T>
+struct is_nothrow<false, T>: true_type
+{};
+
+}   /* shrink_to_fit_detail */
 
+// SFINAE
+// ------
+
+/**
+ *  Detect a native `shrink_to_fit`, from `container_traits`.
+ */
+template <typename T>
+using has_shrink_to_fit = bool_constant<container_traits<T>::has_shrink_to_fit>;
+
+/**
+ *  Detect if the call selected by `shrink_to_fit` cannot throw.
+ */
+template <typename T>
+using is_nothrow_shrink_to_fit = shrink_to_fit_detail::is_nothrow<container_traits<T>::has_shrink_to_fit, T>;
 
 /**
  *  \brief Call `shrink_to_fit` as a functor.
  */
 struct shrink_to_fit
 {
+#if defined(PYCPP_CPP20)
+
     template <typename T>
-    enable_if_t<has_shrink_to_fit<T>::value, void>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    void
+    operator()(
+        T &t
+    )
+    noexcept(is_nothrow_shrink_to_fit<T>::value)
+    {
+        if constexpr (container_traits<T>::has_shrink_to_fit) {
+            t.shrink_to_fit();
+        }
+    }
+
+#else
+
+    template <typename T>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<container_traits<T>::has_shrink_to_fit, void>
     operator()
     (
         T &t
     )
+    noexcept(is_nothrow_shrink_to_fit<T>::value)
     {
         t.shrink_to_fit();
     }
 
     template <typename T>
-    enable_if_t<!has_shrink_to_fit<T>::value, void>
+    PYCPP_SFINAE_INLINE
+    PYCPP_SFINAE_CONSTEXPR
+    enable_if_t<!container_traits<T>::has_shrink_to_fit, void>
     operator()(
         T &t
     )
+    noexcept
     {}
+
+#endif
 };
 
 #ifdef PYCPP_CPP14
@@ -67,7 +126,10 @@ struct shrink_to_fit
 // ------
 
 template <typename T>
-constexpr bool has_shrink_to_fit_v = has_shrink_to_fit<T>::value;
+constexpr bool has_shrink_to_fit_v = container_traits<T>::has_shrink_to_fit;
+
+template <typename T>
+constexpr bool is_nothrow_shrink_to_fit_v = is_nothrow_shrink_to_fit<T>::value;
 
 #endif
 
@@ -0,0 +1,22 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Type identification.
+ *
+ *  Identify specializations of standard types. Includes the
+ *  standard headers defining each identified type.
+ */
+
+#pragma once
+
+#include <pycpp/sfinae/is_complex.h>
+#include <pycpp/sfinae/is_complex_like.h>
+#include <pycpp/sfinae/is_contiguous_container.h>
+#include <pycpp/sfinae/is_pair.h>
+#include <pycpp/sfinae/is_reference_wrapper.h>
+#include <pycpp/sfinae/is_specialization.h>
+#include <pycpp/sfinae/is_string.h>
+#include <pycpp/sfinae/is_string_view.h>
+#include <pycpp/sfinae/is_trivially_relocatable.h>
+#include <pycpp/sfinae/is_tuple.h>
@@ -0,0 +1,115 @@
+//  :copyright: (c) 2017-2018 Alex Huszagh.
+//  :license: MIT, see licenses/mit.md for more details.
+/**
+ *  \addtogroup PyCPP
+ *  \brief Loop vectorization and run-time instruction set dispatch.
+ *
+ *  Implementation details shared by the range kernels, in
+ *  `elementwise.h` and `complex_kernels.h`.
+ *
+ *  `PYCPP_SFINAE_DETAIL_VECTORIZE` precedes a loop, and asserts it has
+ *  no loop-carried dependencies.
+ *
+ *  `vectorize_detail::dispatch(f)` calls `f()`. With GCC and Clang on
+ *  x86, if the build target does not already enable AVX2, the call is
+ *  also compiled as an AVX2 clone (`target("avx2")`, with `flatten`
+ *  inlining `f` into the clone), which is selected at run time if the
+ *  CPU supports AVX2 (`__builtin_cpu_supports`). The check is cached
+ *  after the first call. `PYCPP_SFINAE_DETAIL_DISPATCH` is defined to
+ *  1 if the clone is compiled, and 0 otherwise. Defining
+ *  `PYCPP_SFINAE_NO_DISPATCH` disables the clone. MSVC has no
+ *  per-function target attribute for generated code, so only the
+ *  instruction set enabled at build time (`/arch:AVX2`) is used.
+ *
+ *  \synopsis
+ *      #define PYCPP_SFINAE_DETAIL_VECTORIZE implementation-defined
+ *      #define PYCPP_SFINAE_DETAIL_DISPATCH implementation-defined
+ *
+ *      namespace vectorize_detail
+ *      {
+ *          template <typename F>
+ *          void dispatch(F f);
+ *      }
+ */
+
+#pragma once
+
+#include <pycpp/preprocessor/compiler.h>
+
+// MACROS
+// ------
+
+#if defined(__clang__)
+#   define PYCPP_SFINAE_DETAIL_VECTORIZE _Pragma("clang loop vectorize(enable)")
+#elif defined(__GNUC__)
+#   define PYCPP_SFINAE_DETAIL_VECTORIZE _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+#   define PYCPP_SFINAE_DETAIL_VECTORIZE __pragma(loop(ivdep))
+#else
+#   define PYCPP_SFINAE_DETAIL_VECTORIZE
+#endif
+
+#if !defined(PYCPP_SFINAE_NO_DISPATCH) && !defined(__AVX2__) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#   define PYCPP_SFINAE_DETAIL_DISPATCH 1
+#else
+#   define PYCPP_SFINAE_DETAIL_DISPATCH 0
+#endif
+
+PYCPP_BEGIN_NAMESPACE
+
+namespace vectorize_detail
+{
+// FUNCTIONS
+// ---------
+
+#if PYCPP_SFINAE_DETAIL_DISPATCH
+
+/**
+ *  Detect AVX2 support once.
+ */
+inline
+bool
+has_avx2()
+noexcept
+{
+    static const bool value = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+    return value;
+}
+
+/**
+ *  Call `f`, inlined and compiled for AVX2.
+ */
+template <typename F>
+__attribute__((target("avx2"), flatten))
+void
+call_avx2(
+    F &f
+)
+{
+    f();
+}
+
+#endif
+
+/**
+ *  Call `f`, compiled for the best supported instruction set.
+ */
+template <typename F>
+inline
+void
+dispatch(
+    F f
+)
+{
+#if PYCPP_SFINAE_DETAIL_DISPATCH
+    if (has_avx2()) {
+        call_avx2(f);
+        return;
+    }
+#endif
+    f();
+}
+
+}   /* vectorize_detail */
+
+PYCPP_END_NAMESPACE